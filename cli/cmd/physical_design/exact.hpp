@@ -45,10 +45,15 @@ class exact_command : public command
         add_option("--fixed_size,-f", ps.fixed_size,
                    "Execute only one iteration with the given number of upper bound tiles");
         add_option("--timeout,-t", ps.timeout, "Timeout in seconds");
-        add_option("--async,-a", ps.num_threads, "Number of layout dimensions to examine in parallel (beta feature)");
-
-        add_flag("--async_max,",
-                 "Examine as many layout dimensions in parallel as threads are available (beta feature)");
+        add_flag("--anytime", ps.anytime,
+                 "Fall back to an orthogonal layout if no smaller one is found in time (2DDWave clocking, crossings, "
+                 "and de-synchronization only)");
+        add_option("--async,-a", ps.num_threads,
+                   "Number of layout dimensions to examine in parallel (default: number of available threads)");
+
+        add_flag("--async_max,", "Examine as many layout dimensions in parallel as threads are available");
+        add_option("--portfolio,-p", ps.portfolio_size,
+                   "Number of differently configured solvers that race on each layout dimension");
         add_option("--hex", hexagonal_tile_shift,
                    "Use hexagonal tiles and specify tile shift. Possible values are 'odd_row', 'even_row', "
                    "'odd_column', or 'even_column'");
@@ -196,6 +201,7 @@ class exact_command : public command
         ps_dest.upper_bound_y            = ps_src.upper_bound_y;
         ps_dest.fixed_size               = ps_src.fixed_size;
         ps_dest.num_threads              = ps_src.num_threads;
+        ps_dest.portfolio_size           = ps_src.portfolio_size;
         ps_dest.crossings                = ps_src.crossings;
         ps_dest.io_pins                  = ps_src.io_pins;
         ps_dest.border_io                = ps_src.border_io;
@@ -205,6 +211,7 @@ class exact_command : public command
         ps_dest.minimize_wires           = ps_src.minimize_wires;
         ps_dest.minimize_crossings       = ps_src.minimize_crossings;
         ps_dest.timeout                  = ps_src.timeout;
+        ps_dest.anytime                  = ps_src.anytime;
         ps_dest.technology_specifics     = ps_src.technology_specifics;
 
         return ps_dest;
@@ -35,6 +35,16 @@ if (ENABLE_IPO)
         message(SEND_ERROR "IPO is not supported: ${ipo_output}")
     endif ()
 endif ()
+option(FICTION_ENABLE_NATIVE_ARCHITECTURE "Optimize for the instruction set of the host, e.g., to enable the AVX2/AVX-512 kernels of the SiDB simulation" OFF)
+
+if (FICTION_ENABLE_NATIVE_ARCHITECTURE)
+    if (MSVC)
+        add_compile_options(/arch:AVX2)
+    else ()
+        add_compile_options(-march=native)
+    endif ()
+endif ()
+
 if (CMAKE_CXX_COMPILER_ID MATCHES ".*Clang")
     add_compile_options(-fcolor-diagnostics)
 elseif (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
@@ -0,0 +1,213 @@
+#include "fiction_experiments.hpp"
+
+#include <fiction/io/read_sqd_layout.hpp>                     // reader for SiDB layouts
+#include <fiction/technology/charge_distribution_surface.hpp>  // charge distribution surface
+#include <fiction/technology/sidb_charge_state.hpp>            // SiDB charge states
+#include <fiction/types.hpp>                                   // pre-defined types suitable for the FCN domain
+#include <fiction/utils/aligned_matrix.hpp>                    // cache-aligned matrix storage
+#include <fiction/utils/simd_utils.hpp>                        // vectorized kernels
+
+#include <fmt/format.h>  // output formatting
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// This micro-benchmark compares the local-potential and hop-energy loops of the SiDB simulation on the previous
+// storage layout, i.e., a vector of vectors traversed by scalar loops, with the cache-aligned flat matrix traversed by
+// the vectorized kernels. It operates on the Bestagon layouts in experiments/bestagon/layouts. Compile it with
+// FICTION_ENABLE_NATIVE_ARCHITECTURE to enable the AVX2/AVX-512 kernels. Since these layouts exceed the number of SiDBs
+// for which charge distribution indices can be represented, it has to be built in Release mode.
+
+namespace
+{
+
+template <typename Fn>
+double measure_ns_per_repetition(const uint64_t repetitions, Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t r = 0; r < repetitions; ++r)
+    {
+        fn();
+    }
+
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) /
+           static_cast<double>(repetitions);
+}
+
+}  // namespace
+
+int main()  // NOLINT
+{
+    using cell_lyt = fiction::sidb_cell_clk_lyt_siqad;
+
+    experiments::experiment<std::string, uint64_t, double, double, double, double, double, double, double>
+        kernel_exp{"potential_matrix_kernels",
+                   "benchmark",
+                   "SiDBs",
+                   "matrix init (in ms)",
+                   "local potential, nested (in µs)",
+                   "local potential, flat (in µs)",
+                   "speedup",
+                   "hop scan, nested (in µs)",
+                   "hop scan, flat (in µs)",
+                   "speedup"};
+
+    fmt::print("[i] vectorized kernels use the {} instruction set\n", fiction::SIMD_INSTRUCTION_SET);
+
+    // the total number of matrix elements to traverse per measurement
+    static constexpr const uint64_t work = 200'000'000ull;
+
+    std::mt19937_64 generator{42};
+
+    for (const auto& benchmark : fiction_experiments::all_benchmarks())
+    {
+        const auto path = fmt::format("{}bestagon/layouts/{}.sqd", EXPERIMENTS_PATH, benchmark);
+
+        if (!std::filesystem::exists(path))
+        {
+            continue;
+        }
+
+        fmt::print("[i] processing {}\n", benchmark);
+
+        const auto lyt = fiction::read_sqd_layout<cell_lyt>(path);
+
+        const auto init_start = std::chrono::steady_clock::now();
+
+        const fiction::charge_distribution_surface charge_lyt{lyt};
+
+        const auto init_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - init_start);
+
+        const auto n            = static_cast<uint64_t>(charge_lyt.num_cells());
+        const auto repetitions  = std::max(uint64_t{1}, work / (n * n));
+        const auto no_threshold = std::numeric_limits<double>::lowest();
+
+        // previous storage layout: one heap allocation per row
+        std::vector<std::vector<double>> nested(n, std::vector<double>(n, 0.0));
+        // current storage layout: one allocation with cache-aligned rows
+        fiction::aligned_matrix<double> flat{n, n};
+
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            for (uint64_t j = 0; j < n; ++j)
+            {
+                nested[i][j] = flat(i, j) = charge_lyt.get_electrostatic_potential_by_indices(i, j);
+            }
+        }
+
+        // a random charge distribution consisting of negative and neutral SiDBs
+        std::bernoulli_distribution             negative{0.5};
+        std::vector<fiction::sidb_charge_state> charges(n);
+        fiction::aligned_vector<double>         signs(n);
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            charges[i] =
+                negative(generator) ? fiction::sidb_charge_state::NEGATIVE : fiction::sidb_charge_state::NEUTRAL;
+            signs[i] = static_cast<double>(fiction::charge_state_to_sign(charges[i]));
+        }
+
+        std::vector<double>             nested_loc_pot(n, 0.0);
+        fiction::aligned_vector<double> flat_loc_pot(n, 0.0);
+
+        const auto nested_loc_pot_ns = measure_ns_per_repetition(
+            repetitions,
+            [&]
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    double collect = 0;
+                    for (uint64_t j = 0; j < n; ++j)
+                    {
+                        collect += nested[i][j] * static_cast<double>(fiction::charge_state_to_sign(charges[j]));
+                    }
+
+                    nested_loc_pot[i] = collect;
+                }
+            });
+
+        const auto flat_loc_pot_ns = measure_ns_per_repetition(
+            repetitions,
+            [&]
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    flat_loc_pot[i] = fiction::dot_product(flat[i], signs.data(), n);
+                }
+            });
+
+        // both hop scans are forced to traverse all SiDB pairs, which is the case for physically valid distributions
+        uint64_t   nested_hops   = 0;
+        const auto nested_hop_ns = measure_ns_per_repetition(
+            repetitions,
+            [&]
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    const int dn_i = (charges[i] == fiction::sidb_charge_state::NEGATIVE) ? 1 : -1;
+
+                    for (uint64_t j = 0; j < n; ++j)
+                    {
+                        const auto e_del = nested_loc_pot[i] * dn_i - nested_loc_pot[j] * dn_i - nested[i][j];
+
+                        if (fiction::charge_state_to_sign(charges[j]) > fiction::charge_state_to_sign(charges[i]) &&
+                            e_del < no_threshold)
+                        {
+                            ++nested_hops;
+                        }
+                    }
+                }
+            });
+
+        uint64_t   flat_hops   = 0;
+        const auto flat_hop_ns = measure_ns_per_repetition(
+            repetitions,
+            [&]
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    const double dn_i = (charges[i] == fiction::sidb_charge_state::NEGATIVE) ? 1.0 : -1.0;
+
+                    if (fiction::any_hop_below_threshold(flat[i], flat_loc_pot.data(), signs.data(), n, signs[i],
+                                                         flat_loc_pot[i], dn_i, no_threshold))
+                    {
+                        ++flat_hops;
+                    }
+                }
+            });
+
+        // both variants have to agree on the local potentials
+        for (uint64_t i = 0; i < n; ++i)
+        {
+            if (std::abs(nested_loc_pot[i] - flat_loc_pot[i]) > 1E-9)
+            {
+                fmt::print("[e] local potentials of {} differ at SiDB {}\n", benchmark, i);
+            }
+        }
+
+        kernel_exp(benchmark, n, init_ms.count(), nested_loc_pot_ns / 1000.0, flat_loc_pot_ns / 1000.0,
+                   nested_loc_pot_ns / flat_loc_pot_ns, nested_hop_ns / 1000.0, flat_hop_ns / 1000.0,
+                   nested_hop_ns / flat_hop_ns);
+
+        kernel_exp.save();
+        kernel_exp.table();
+
+        // prevents the hop scans from being optimized away
+        if (nested_hops + flat_hops != 0)
+        {
+            fmt::print("[w] unexpected hops found\n");
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
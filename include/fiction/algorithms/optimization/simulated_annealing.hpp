@@ -52,10 +52,14 @@ constexpr auto geometric_temperature_schedule(const double t) noexcept
  * This implementation is based on:
  * https://codereview.stackexchange.com/questions/70310/simple-simulated-annealing-template-in-c11
  *
+ * This overload draws the random numbers that decide whether worse states are accepted from the given generator. If
+ * `next` draws from the same generator, the result only depends on the generator's initial state.
+ *
  * @tparam State The state type.
  * @tparam CostFunc The cost function type (specifies the cost type via its return value).
  * @tparam TempFunc The temperature schedule function type.
  * @tparam NextFunc The next state function type.
+ * @tparam Generator The random number generator type.
  * @param init_state The initial state to optimize.
  * @param init_temp The initial temperature.
  * @param final_temp The final temperature.
@@ -63,12 +67,13 @@ constexpr auto geometric_temperature_schedule(const double t) noexcept
  * @param cost The cost function to minimize.
  * @param schedule The temperature schedule.
  * @param next The next state function that determines an adjacent state given a current one.
+ * @param generator The random number generator to draw the acceptance probabilities from.
  * @return A pair of the optimized state and its cost value.
  */
-template <typename State, typename CostFunc, typename TempFunc, typename NextFunc>
+template <typename State, typename CostFunc, typename TempFunc, typename NextFunc, typename Generator>
 std::pair<State, std::invoke_result_t<CostFunc, State>>
 simulated_annealing(const State& init_state, const double init_temp, const double final_temp, const std::size_t cycles,
-                    CostFunc&& cost, TempFunc&& schedule, NextFunc&& next) noexcept
+                    CostFunc&& cost, TempFunc&& schedule, NextFunc&& next, Generator& generator) noexcept
 {
     static_assert(std::is_invocable_v<CostFunc, State>, "CostFunc must be invocable with objects of type State");
     static_assert(std::is_invocable_v<TempFunc, double>, "TempFunc must be invocable with double");
@@ -81,9 +86,7 @@ simulated_annealing(const State& init_state, const double init_temp, const doubl
     assert(std::isfinite(init_temp) && "init_temp must be a finite number");
     assert(std::isfinite(final_temp) && "final_temp must be a finite number");
 
-    static std::mt19937_64 generator{std::random_device{}()};
-
-    static std::uniform_real_distribution<double> random_functor(0, 1);
+    std::uniform_real_distribution<double> random_functor(0, 1);
 
     auto current_cost  = cost(init_state);
     auto current_state = init_state;
@@ -132,6 +135,34 @@ simulated_annealing(const State& init_state, const double init_temp, const doubl
 
     return {best_state, best_cost};
 }
+/**
+ * Simulated Annealing (SA) as specified above that draws the random numbers that decide whether worse states are
+ * accepted from a thread-local generator seeded by `std::random_device`.
+ *
+ * @tparam State The state type.
+ * @tparam CostFunc The cost function type (specifies the cost type via its return value).
+ * @tparam TempFunc The temperature schedule function type.
+ * @tparam NextFunc The next state function type.
+ * @param init_state The initial state to optimize.
+ * @param init_temp The initial temperature.
+ * @param final_temp The final temperature.
+ * @param cycles The number of cycles for each temperature value.
+ * @param cost The cost function to minimize.
+ * @param schedule The temperature schedule.
+ * @param next The next state function that determines an adjacent state given a current one.
+ * @return A pair of the optimized state and its cost value.
+ */
+template <typename State, typename CostFunc, typename TempFunc, typename NextFunc>
+std::pair<State, std::invoke_result_t<CostFunc, State>>
+simulated_annealing(const State& init_state, const double init_temp, const double final_temp, const std::size_t cycles,
+                    CostFunc&& cost, TempFunc&& schedule, NextFunc&& next) noexcept
+{
+    // thread-local such that multiple instances can be run concurrently
+    static thread_local std::mt19937_64 generator{std::random_device{}()};
+
+    return simulated_annealing(init_state, init_temp, final_temp, cycles, std::forward<CostFunc>(cost),
+                               std::forward<TempFunc>(schedule), std::forward<NextFunc>(next), generator);
+}
 /**
  * This variation of Simulated Annealing (SA) does not start from just one provided initial state, but generates a
  * number of random initial states using a provided random state generator. SA as specified above is then run on all
@@ -9,6 +9,7 @@
 
 #include "fiction/algorithms/iter/aspect_ratio_iterator.hpp"
 #include "fiction/algorithms/network_transformation/fanout_substitution.hpp"
+#include "fiction/algorithms/physical_design/orthogonal.hpp"
 #include "fiction/io/print_layout.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
 #include "fiction/technology/cell_ports.hpp"
@@ -37,18 +38,21 @@
 #include <z3++.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
-#include <future>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -88,11 +92,19 @@ struct exact_physical_design_params
      */
     bool fixed_size = false;
     /**
-     * Number of threads to use for exploring the possible aspect ratios.
-     *
-     * @note This is an unstable beta feature.
+     * Number of threads to use for exploring the possible aspect ratios. Each thread works on its own SMT context. The
+     * resulting layout has the same aspect ratio as a single-threaded run would yield, but its placement and routing
+     * might differ. By default, the number of threads is set to the number of available hardware threads.
+     */
+    std::size_t num_threads = std::thread::hardware_concurrency();
+    /**
+     * Number of differently configured SMT solvers that race on each aspect ratio. The configurations differ in their
+     * random seeds, their phase selection strategies, and whether they employ hierarchy-based symmetry breaking. The
+     * first solver to prove an aspect ratio SAT or UNSAT wins, which mitigates the heavy-tailed runtime distribution
+     * of a single configuration. Each solver runs in its own thread, i.e., up to `num_threads * portfolio_size`
+     * threads are used in total. A portfolio size of 1 uses Z3's default configuration only.
      */
-    std::size_t num_threads = 1ul;
+    std::size_t portfolio_size = 1ul;
     /**
      * Flag to indicate that crossings may be used.
      */
@@ -129,6 +141,25 @@ struct exact_physical_design_params
      * Sets a timeout in ms for the solving process. Standard is 4294967 seconds as defined by Z3.
      */
     unsigned timeout = 4294967u;
+    /**
+     * Flag to indicate that the anytime strategy should be used. An upper bound layout is obtained first and only
+     * aspect ratios of smaller area are explored afterwards. If no smaller layout is found, e.g., because the timeout
+     * was reached, the upper bound layout is returned instead of `std::nullopt`. If the timeout is reached after a
+     * smaller but not necessarily minimal layout has been found by the parallel strategy, that layout is returned.
+     *
+     * Unless `upper_bound_layout` is given, the upper bound layout is obtained via the orthogonal physical design
+     * algorithm. Since the orthogonal layout neither places its I/Os at the borders, nor routes its inverters straight,
+     * nor balances its paths, it is only used for Cartesian layouts under 2DDWave clocking with crossings enabled and
+     * desynchronization enabled, without border I/Os, straight inverters, a black list, technology-specific
+     * constraints, or a fixed size, and only if it fits into `upper_bound_x` and `upper_bound_y`. Otherwise, the
+     * anytime strategy behaves like the default one, i.e., `std::nullopt` is returned if no layout is found.
+     */
+    bool anytime = false;
+    /**
+     * Layout that implements the specification network and serves as the upper bound of the anytime strategy instead
+     * of the orthogonal one.
+     */
+    std::optional<Lyt> upper_bound_layout = std::nullopt;
     /**
      * Technology-specific constraints that are only to be added for a certain target technology.
      */
@@ -137,6 +168,11 @@ struct exact_physical_design_params
      * Maps tiles to blacklisted gate types via their truth tables and port information.
      */
     surface_black_list<Lyt, port_direction> black_list{};
+    /**
+     * Dimensions (number of tiles in x and y direction) of aspect ratios that are known to be unsatisfiable under the
+     * given parameters, e.g., from previous runs. These aspect ratios are skipped.
+     */
+    std::vector<std::pair<uint64_t, uint64_t>> unsatisfiable_aspect_ratios{};
 };
 /**
  * Statistics.
@@ -149,6 +185,19 @@ struct exact_physical_design_stats
     uint64_t num_gates{0ull}, num_wires{0ull};
 
     uint32_t num_aspect_ratios{0ul};
+    /**
+     * Flag to indicate that the anytime strategy returned its upper bound layout because no smaller one was found.
+     */
+    bool upper_bound_layout_returned{false};
+    /**
+     * Flag to indicate that all examined aspect ratios preceding the one of the returned layout were proven
+     * unsatisfiable, i.e., that the layout is of minimal area under the given parameters.
+     */
+    bool optimal{false};
+    /**
+     * Dimensions (number of tiles in x and y direction) of the aspect ratios that were proven unsatisfiable.
+     */
+    std::vector<std::pair<uint64_t, uint64_t>> unsatisfiable_aspect_ratios{};
 
     void report(std::ostream& out = std::cout) const
     {
@@ -185,16 +234,38 @@ class exact_impl
         ari = aspect_ratio_iterator<typename Lyt::aspect_ratio>{
             ps.fixed_size ? static_cast<uint64_t>(ps.upper_bound_x * ps.upper_bound_y) :
                             static_cast<uint64_t>(lower_bound)};
+
+        max_area = static_cast<uint64_t>(ps.upper_bound_x) * static_cast<uint64_t>(ps.upper_bound_y);
+
+        if (ps.anytime)
+        {
+            upper_bound_layout = ps.upper_bound_layout.has_value() ? ps.upper_bound_layout : orthogonal_layout(src);
+
+            if (upper_bound_layout.has_value())
+            {
+                // only layouts that are smaller than the upper bound are of interest
+                max_area = std::min(max_area, area(*upper_bound_layout) - 1);
+            }
+        }
     }
 
     std::optional<Lyt> run()
     {
-        if (ps.num_threads > 1)
+        auto layout = ps.num_threads > 1 ? run_asynchronously() : run_synchronously();
+
+        if (!layout.has_value() && upper_bound_layout.has_value())
         {
-            return run_asynchronously();
+            layout = upper_bound_layout;
+
+            // statistical information
+            pst.x_size                      = layout->x() + 1;
+            pst.y_size                      = layout->y() + 1;
+            pst.num_gates                   = layout->num_gates();
+            pst.num_wires                   = layout->num_wires();
+            pst.upper_bound_layout_returned = true;
         }
 
-        return run_synchronously();
+        return layout;
     }
 
   private:
@@ -224,18 +295,123 @@ class exact_impl
      */
     aspect_ratio_iterator<typename Lyt::aspect_ratio> ari{0};
     /**
-     * Aspect ratio of found result. Only needed for the asynchronous case.
+     * Maximum number of layout tiles to explore.
      */
-    std::optional<typename Lyt::aspect_ratio> result_aspect_ratio;
+    uint64_t max_area{0ull};
     /**
-     * Restricts access to the aspect_ratio_iterator and the result_aspect_ratio.
+     * Layout that is returned by the anytime strategy if no smaller one is found.
      */
-    std::mutex ari_mutex{}, rar_mutex{};
+    std::optional<Lyt> upper_bound_layout{std::nullopt};
+    /**
+     * Computes the number of tiles of the given layout's ground layer.
+     *
+     * @param lyt Layout whose area is to be computed.
+     * @return Number of tiles of `lyt`'s ground layer.
+     */
+    [[nodiscard]] static uint64_t area(const Lyt& lyt) noexcept
+    {
+        return static_cast<uint64_t>(lyt.x() + 1) * static_cast<uint64_t>(lyt.y() + 1);
+    }
+    /**
+     * Obtains the upper bound layout of the anytime strategy via the orthogonal physical design algorithm if the
+     * given parameters admit its layouts, i.e., if the orthogonal layout satisfies all requested constraints and fits
+     * into the upper bounds of the layout dimensions.
+     *
+     * @param src Specification network.
+     * @return An orthogonal layout of `src` or `std::nullopt` if the orthogonal algorithm is not applicable.
+     */
+    [[nodiscard]] std::optional<Lyt> orthogonal_layout(const Ntk& src) const
+    {
+        if constexpr (is_cartesian_layout_v<Lyt>)
+        {
+            // the orthogonal layout neither places its I/Os at the borders, nor routes its inverters straight, nor
+            // balances its paths
+            if (*ps.scheme == clock_name::TWODDWAVE && ps.crossings && ps.desynchronize && !ps.border_io &&
+                !ps.straight_inverters && !ps.fixed_size && ps.black_list.empty() &&
+                ps.technology_specifics == technology_constraints::NONE && !has_high_degree_fanin_nodes(src, 2))
+            {
+                const orthogonal_physical_design_params orthogonal_ps{
+                    ps.scheme->num_clocks == 3u ? num_clks::THREE : num_clks::FOUR};
+
+                auto layout = mockturtle::call_with_stopwatch(pst.time_total, [&src, &orthogonal_ps]
+                                                              { return orthogonal<Lyt>(src, orthogonal_ps); });
+
+                if (static_cast<uint64_t>(layout.x()) + 1 <= ps.upper_bound_x &&
+                    static_cast<uint64_t>(layout.y()) + 1 <= ps.upper_bound_y)
+                {
+                    return layout;
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Returns the dimensions of the given aspect ratio, i.e., its number of tiles in x and y direction.
+     *
+     * @param ar Aspect ratio.
+     * @return Dimensions of `ar`.
+     */
+    [[nodiscard]] static std::pair<uint64_t, uint64_t> dimensions(const typename Lyt::aspect_ratio& ar) noexcept
+    {
+        return {static_cast<uint64_t>(ar.x) + 1, static_cast<uint64_t>(ar.y) + 1};
+    }
+    /**
+     * Checks whether the given aspect ratio is known to be unsatisfiable (see
+     * `exact_physical_design_params::unsatisfiable_aspect_ratios`).
+     *
+     * @param ar Aspect ratio to check.
+     * @return `true` iff `ar` does not need to be explored because it is known to be unsatisfiable.
+     */
+    [[nodiscard]] bool known_unsatisfiable(const typename Lyt::aspect_ratio& ar) const noexcept
+    {
+        return std::find(ps.unsatisfiable_aspect_ratios.cbegin(), ps.unsatisfiable_aspect_ratios.cend(),
+                         dimensions(ar)) != ps.unsatisfiable_aspect_ratios.cend();
+    }
 
     using ctx_ptr      = std::shared_ptr<z3::context>;
     using solver_ptr   = std::shared_ptr<z3::solver>;
     using optimize_ptr = std::shared_ptr<z3::optimize>;
 
+    /**
+     * Configuration of an SMT solver as part of a solver portfolio.
+     */
+    struct solver_configuration
+    {
+        /**
+         * Random seed of the solver.
+         */
+        unsigned random_seed{0u};
+        /**
+         * Phase selection strategy of Z3's SMT core. The default value of 3 refers to conservative phase caching.
+         */
+        unsigned phase_selection{3u};
+        /**
+         * Flag to indicate that symmetry breaking constraints based on the network hierarchy should be generated.
+         */
+        bool hierarchical_symmetry_breaking{true};
+    };
+    /**
+     * Returns the i-th configuration of a solver portfolio. The 0-th one is Z3's default configuration using all
+     * symmetry breaking constraints. All further ones use distinct random seeds, cycle through the phase selection
+     * strategies always-false (0), random (5), and phase caching (2), and alternately omit the hierarchy-based symmetry
+     * breaking.
+     *
+     * @param i Index of the configuration in the portfolio.
+     * @return The i-th solver configuration.
+     */
+    [[nodiscard]] static solver_configuration portfolio_configuration(const std::size_t i) noexcept
+    {
+        if (i == 0)
+        {
+            return {};
+        }
+
+        constexpr std::array<unsigned, 3> phase_selections{{0u, 5u, 2u}};
+
+        return {static_cast<unsigned>(i), phase_selections[(i - 1) % phase_selections.size()], i % 2 == 0};
+    }
+
     /**
      * Sub-class to exact to handle construction of SMT instances as well as house-keeping like storing solver
      * states across incremental calls etc. Multiple handlers can be created in order to explore possible aspect ratios
@@ -250,16 +426,20 @@ class exact_impl
          * @param ctxp The context that is used in all solvers.
          * @param lyt The empty gate-level layout that is going to contain the created layout.
          * @param ps The parameters to respect in the SMT instance generation process.
+         * @param cfg The configuration of all solvers.
          */
-        smt_handler(ctx_ptr ctxp, Lyt& lyt, const topology_ntk_t& ntk,
-                    const exact_physical_design_params<Lyt>& ps) noexcept :
+        smt_handler(ctx_ptr ctxp, Lyt& lyt, const topology_ntk_t& ntk, const exact_physical_design_params<Lyt>& ps,
+                    const solver_configuration& cfg = {}) noexcept :
                 ctx{std::move(ctxp)},
                 layout{lyt},
                 network{ntk},
                 params{ps},
+                config{cfg},
                 node2pos{ntk},
                 depth_ntk{ntk},
-                inv_levels{inverse_levels(ntk)}
+                inv_levels{inverse_levels(ntk)},
+                placement_levels{compute_placement_levels()},
+                probe{{}, *ps.scheme}
         {}
         /**
          * Evaluates a given aspect ratio regarding the stored configurations whether it can be skipped, i.e., does not
@@ -328,7 +508,8 @@ class exact_impl
             layout.resize({ar.x, ar.y, params.crossings ? 1 : 0});
             check_point = std::make_shared<solver_check_point>(fetch_solver(ar));
             ++lc;
-            solver = check_point->state->solver;
+            solver      = check_point->state->solver;
+            last_result = z3::unknown;
         }
         /**
          * Sets the given timeout for the current solver.
@@ -355,7 +536,9 @@ class exact_impl
         {
             generate_smt_instance();
 
-            if (const auto z3_result = solver->check(check_point->assumptions); z3_result == z3::sat)
+            last_result = solver->check(check_point->assumptions);
+
+            if (last_result == z3::sat)
             {
                 // optimize the generated result
                 if (auto opt = optimize(); opt != nullptr)
@@ -373,6 +556,16 @@ class exact_impl
 
             return false;
         }
+        /**
+         * Checks whether the last call to `is_satisfiable` proved the instance to be UNSAT. If the solver was
+         * interrupted or timed out instead, the instance might still be SAT.
+         *
+         * @return `true` iff the instance generated for the current configuration was proven to be UNSAT.
+         */
+        [[nodiscard]] bool is_unsatisfiable() const noexcept
+        {
+            return last_result == z3::unsat;
+        }
         /**
          * Stores the current solver state in the solver tree with aspect ratio ar as key.
          *
@@ -472,6 +665,10 @@ class exact_impl
          * Configurations specifying layout restrictions. Used in instance generation among other places.
          */
         const exact_physical_design_params<Lyt> params;
+        /**
+         * Configuration of all solvers.
+         */
+        const solver_configuration config;
         /**
          * Maps nodes to tile positions when creating the layout from the SMT model.
          */
@@ -491,6 +688,48 @@ class exact_impl
          * Mapping of inverse levels to nodes used for symmetry breaking.
          */
         const std::vector<uint32_t> inv_levels;
+        /**
+         * Levels of all nodes by index that only count placed nodes, i.e., the minimum number of tiles that are to be
+         * traversed from a placed node without predecessors to the respective node.
+         */
+        const std::vector<uint32_t> placement_levels;
+        /**
+         * Structural properties of a tile that do not depend on the layout's aspect ratio. They determine which
+         * placements on the tile are possible at all.
+         */
+        struct tile_properties
+        {
+            /**
+             * Flags indexed by node that indicate whether the respective node can be placed on the tile.
+             */
+            std::vector<bool> placeable_nodes{};
+            /**
+             * Number of tiles on the longest clocked path that ends in the tile. Only limited for linear clocking
+             * schemes.
+             */
+            uint32_t depth{std::numeric_limits<uint32_t>::max()};
+            /**
+             * Flag that indicates whether edges can be routed through the tile.
+             */
+            bool edges_placeable{false};
+            /**
+             * Flag that indicates whether any node or edge can be assigned to the tile.
+             */
+            bool usable{false};
+        };
+        /**
+         * Layout that is only used to determine tile properties. It is never shrunk so that the properties of all
+         * tiles examined so far remain valid.
+         */
+        Lyt probe;
+        /**
+         * Stores the properties of all tiles examined so far.
+         */
+        std::unordered_map<typename Lyt::tile, tile_properties> tile_property_cache{};
+        /**
+         * Stores the clocked depths of all tiles examined so far.
+         */
+        std::unordered_map<typename Lyt::tile, uint32_t> tile_depth_cache{};
         /**
          * Assumption literal counter.
          */
@@ -513,6 +752,10 @@ class exact_impl
          * Shortcut to the solver stored in check_point.
          */
         solver_ptr solver;
+        /**
+         * Result of the last solver check.
+         */
+        z3::check_result last_result{z3::unknown};
         /**
          * Returns the lc-th eastern assumption literal from the stored context.
          *
@@ -615,6 +858,11 @@ class exact_impl
             // create new state
             solver_state new_state{std::make_shared<z3::solver>(*ctx), {get_lit_e(), get_lit_s()}};
 
+            z3::params p{*ctx};
+            p.set("random_seed", config.random_seed);
+            p.set("smt.phase_selection", config.phase_selection);
+            new_state.solver->set(p);
+
             return {std::make_shared<solver_state>(new_state), added_tiles, {}, create_assumptions(new_state)};
         }
         /**
@@ -743,7 +991,206 @@ class exact_impl
             return check_point->state->lit;
         }
         /**
-         * Returns a tn variable from the stored context representing that tile t has node n assigned.
+         * Computes the levels of all nodes in the stored network that only count placed nodes, i.e., constants and
+         * skipped I/Os are disregarded.
+         *
+         * @return Placement levels of all nodes by index.
+         */
+        [[nodiscard]] std::vector<uint32_t> compute_placement_levels() const noexcept
+        {
+            std::vector<uint32_t> levels(network.size(), 0u);
+
+            // the network is topologically sorted
+            network.foreach_node(
+                [this, &levels](const auto& n)
+                {
+                    if (skip_const_or_io_node(n))
+                    {
+                        return;
+                    }
+
+                    network.foreach_fanin(n,
+                                          [this, &n, &levels](const auto& fi)
+                                          {
+                                              if (const auto fn = network.get_node(fi); !skip_const_or_io_node(fn))
+                                              {
+                                                  levels[network.node_to_index(n)] =
+                                                      std::max(levels[network.node_to_index(n)],
+                                                               levels[network.node_to_index(fn)] + 1u);
+                                              }
+                                          });
+                });
+
+            return levels;
+        }
+        /**
+         * Returns the number of tiles on the longest clocked path that ends in tile t. Must only be called for linear
+         * clocking schemes, where such paths are finite. If a path leaves the north-western quadrant of t, it might
+         * be extended in larger layouts and the depth is considered unlimited.
+         *
+         * @param t Tile whose clocked depth is desired. Must be located within the bounds of probe.
+         * @return Number of tiles preceding t on its longest incoming clocked path.
+         */
+        [[nodiscard]] uint32_t clocked_depth(const typename Lyt::tile& t)
+        {
+            if (const auto it = tile_depth_cache.find(t); it != tile_depth_cache.cend())
+            {
+                return it->second;
+            }
+
+            static constexpr const auto unlimited = std::numeric_limits<uint32_t>::max();
+
+            uint32_t depth{0};
+            probe.foreach_incoming_clocked_zone(
+                t,
+                [this, &t, &depth](const auto& it)
+                {
+                    if (it.x > t.x || it.y > t.y)
+                    {
+                        depth = unlimited;
+                    }
+                    else if (const auto d = clocked_depth(it); d == unlimited)
+                    {
+                        depth = unlimited;
+                    }
+                    else
+                    {
+                        depth = std::max(depth, d + 1u);
+                    }
+                });
+
+            tile_depth_cache[t] = depth;
+
+            return depth;
+        }
+        /**
+         * Determines the structural properties of tile t that do not depend on the layout's aspect ratio. A node n
+         * cannot be placed on t if t lacks the connectivity to host n's fan-ins and fan-outs even in an arbitrarily
+         * large layout, if t is located too close to the layout's origin to host n given its placement level and the
+         * clocking scheme, or if n's function is black-listed on t for all ports. Likewise, edges cannot be routed
+         * through t if t lacks connectivity, if t is located too close to the origin, or if wires are black-listed on
+         * t.
+         *
+         * The results are cached such that all placements on t are evaluated only once.
+         *
+         * @param t Tile whose properties are desired.
+         * @return Structural properties of t.
+         */
+        [[nodiscard]] const tile_properties& properties(const typename Lyt::tile& t)
+        {
+            if (const auto it = tile_property_cache.find(t); it != tile_property_cache.cend())
+            {
+                return it->second;
+            }
+
+            // grow the probe such that all neighbors of t exist
+            if (static_cast<uint64_t>(t.x) + 1 > static_cast<uint64_t>(probe.x()) ||
+                static_cast<uint64_t>(t.y) + 1 > static_cast<uint64_t>(probe.y()))
+            {
+                probe.resize({std::max(probe.x(), static_cast<decltype(probe.x())>(t.x + 1)),
+                              std::max(probe.y(), static_cast<decltype(probe.y())>(t.y + 1)), 0});
+            }
+
+            tile_properties tp{};
+
+            const auto regular = probe.is_regularly_clocked();
+
+            const uint32_t in_degree    = regular ? probe.in_degree(t) : 0u;
+            const uint32_t out_degree   = regular ? probe.out_degree(t) : 0u;
+            const uint32_t tile_degree  = num_adjacent_coordinates(probe, t);
+            const auto     black_listed = params.black_list.find(t);
+
+            if (is_linear_scheme<Lyt>(probe.get_clocking_scheme()))
+            {
+                tp.depth = clocked_depth(t);
+            }
+
+            // checks whether the given function is black-listed on t regardless of the ports
+            const auto is_black_listed = [this, &black_listed](const kitty::dynamic_truth_table& f)
+            {
+                if (black_listed == params.black_list.cend())
+                {
+                    return false;
+                }
+
+                return std::any_of(black_listed->second.cbegin(), black_listed->second.cend(),
+                                   [&f](const auto& exclusion)
+                                   { return exclusion.second.empty() && kitty::equal(exclusion.first, f); });
+            };
+
+            tp.placeable_nodes.assign(network.size(), false);
+
+            network.foreach_node(
+                [&, this](const auto& n)
+                {
+                    if (skip_const_or_io_node(n))
+                    {
+                        return;
+                    }
+
+                    const auto connectable = regular ? in_degree >= network_in_degree(n) &&
+                                                           out_degree >= network_out_degree(n) :
+                                                       tile_degree >= network_in_degree(n) + network_out_degree(n);
+
+                    const auto placeable = connectable && tp.depth >= placement_levels[network.node_to_index(n)] &&
+                                           !is_black_listed(network.node_function(n));
+
+                    tp.placeable_nodes[network.node_to_index(n)] = placeable;
+                    tp.usable |= placeable;
+                });
+
+            tp.edges_placeable = (regular ? in_degree > 0 && out_degree > 0 : tile_degree >= 2) && tp.depth > 0 &&
+                                 !is_black_listed(create_id_tt());
+            tp.usable |= tp.edges_placeable;
+
+            return tile_property_cache.emplace(t, std::move(tp)).first->second;
+        }
+        /**
+         * Checks whether node n can be placed on tile t based on the tile's structural properties. Only tiles within
+         * the layout bounds are evaluated.
+         *
+         * @param t Tile to be considered.
+         * @param n Node to be considered.
+         * @return `false` iff n can never be placed on t.
+         */
+        [[nodiscard]] bool is_placeable(const typename Lyt::tile& t, const mockturtle::node<topology_ntk_t>& n)
+        {
+            return !layout.is_within_bounds(t) || properties(t).placeable_nodes[network.node_to_index(n)];
+        }
+        /**
+         * Checks whether edge e can be routed through tile t based on the tile's structural properties. Only tiles
+         * within the layout bounds are evaluated.
+         *
+         * @param t Tile to be considered.
+         * @param e Edge to be considered.
+         * @return `false` iff e can never be routed through t.
+         */
+        [[nodiscard]] bool is_placeable(const typename Lyt::tile& t, const mockturtle::edge<topology_ntk_t>& e)
+        {
+            if (!layout.is_within_bounds(t))
+            {
+                return true;
+            }
+
+            const auto& tp = properties(t);
+
+            // the edge's tile is located behind its source's tile
+            return tp.edges_placeable && tp.depth > placement_levels[network.node_to_index(e.source)];
+        }
+        /**
+         * Checks whether any node or edge can be assigned to tile t based on the tile's structural properties. Only
+         * tiles within the layout bounds are evaluated.
+         *
+         * @param t Tile to be considered.
+         * @return `false` iff t remains empty in any layout.
+         */
+        [[nodiscard]] bool is_usable(const typename Lyt::tile& t)
+        {
+            return !layout.is_within_bounds(t) || properties(t).usable;
+        }
+        /**
+         * Returns a tn variable from the stored context representing that tile t has node n assigned. If n can never
+         * be placed on t, no variable is created but the constant false is returned.
          *
          * @param t Tile to be considered.
          * @param n Node to be considered.
@@ -751,10 +1198,16 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tn(const typename Lyt::tile& t, const mockturtle::node<topology_ntk_t>& n)
         {
+            if (!is_placeable(t, n))
+            {
+                return ctx->bool_val(false);
+            }
+
             return ctx->bool_const(fmt::format("tn_({},{})_{}", t.x, t.y, n).c_str());
         }
         /**
-         * Returns a te variable from the stored context representing that tile t has edge e assigned.
+         * Returns a te variable from the stored context representing that tile t has edge e assigned. If e can never
+         * be routed through t, no variable is created but the constant false is returned.
          *
          * @param t Tile to be considered.
          * @param e Edge to be considered.
@@ -762,10 +1215,16 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_te(const typename Lyt::tile& t, const mockturtle::edge<topology_ntk_t>& e)
         {
+            if (!is_placeable(t, e))
+            {
+                return ctx->bool_val(false);
+            }
+
             return ctx->bool_const(fmt::format("te_({},{})_({},{})", t.x, t.y, e.source, e.target).c_str());
         }
         /**
          * Returns a tc variable from the stored context representing that information flows from tile t1 to tile t2.
+         * If either tile remains empty in any layout, no variable is created but the constant false is returned.
          *
          * @param t1 Tile 1 to be considered.
          * @param t2 Tile 2 to be considered that is adjacent to t1.
@@ -773,10 +1232,16 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tc(const typename Lyt::tile& t1, const typename Lyt::tile& t2)
         {
+            if (!is_usable(t1) || !is_usable(t2))
+            {
+                return ctx->bool_val(false);
+            }
+
             return ctx->bool_const(fmt::format("tc_({},{})_({},{})", t1.x, t1.y, t2.x, t2.y).c_str());
         }
         /**
-         * Returns a tp variable from the stored context representing that a path from tile t1 to tile t2 exists.
+         * Returns a tp variable from the stored context representing that a path from tile t1 to tile t2 exists. If
+         * either tile remains empty in any layout, no variable is created but the constant false is returned.
          *
          * @param t1 Tile 1 to be considered.
          * @param t2 Tile 2 to be considered.
@@ -784,6 +1249,11 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tp(const typename Lyt::tile& t1, const typename Lyt::tile& t2)
         {
+            if (!is_usable(t1) || !is_usable(t2))
+            {
+                return ctx->bool_val(false);
+            }
+
             return ctx->bool_const(fmt::format("tp_({},{})_({},{})", t1.x, t1.y, t2.x, t2.y).c_str());
         }
         /**
@@ -2537,7 +3007,11 @@ class exact_impl
             // symmetry breaking constraints
             prevent_insufficiencies();
             define_number_of_connections();
-            utilize_hierarchical_information();
+
+            if (config.hierarchical_symmetry_breaking)
+            {
+                utilize_hierarchical_information();
+            }
         }
         /**
          * Creates and returns a z3::optimize if optimization criteria were set by the configuration. The optimize gets
@@ -2775,15 +3249,247 @@ class exact_impl
             restore_names(network, layout, node2pos);
         }
     };
+    /**
+     * A portfolio of SMT handlers that work on the same aspect ratios using different solver configurations (see
+     * `portfolio_configuration`). Each handler creates its instances in its own context and designs its own layout.
+     * When solving, all handlers race in separate threads and the first conclusive answer, i.e., SAT or UNSAT, is
+     * adopted while the remaining handlers are interrupted. A portfolio consisting of a single handler solves in the
+     * calling thread without any synchronization overhead.
+     */
+    class solver_portfolio
+    {
+      public:
+        /**
+         * Standard constructor.
+         *
+         * @param ctxps The contexts to use, one per handler. The number of contexts determines the portfolio size.
+         * @param lyt The empty gate-level layout that is going to contain the created layout.
+         * @param ntk The network to be placed and routed.
+         * @param ps The parameters to respect in the SMT instance generation process.
+         */
+        solver_portfolio(const std::vector<ctx_ptr>& ctxps, Lyt& lyt, const topology_ntk_t& ntk,
+                         const exact_physical_design_params<Lyt>& ps) :
+                contexts{ctxps},
+                layout{lyt},
+                failed(ctxps.size(), false)
+        {
+            // all handlers but the first one design their own layouts
+            for (std::size_t i = 1ul; i < contexts.size(); ++i)
+            {
+                member_layouts.push_back(std::make_unique<Lyt>(typename Lyt::aspect_ratio{}, *ps.scheme));
+            }
+
+            for (std::size_t i = 0ul; i < contexts.size(); ++i)
+            {
+                handlers.push_back(std::make_unique<smt_handler>(contexts[i], i == 0 ? lyt : *member_layouts[i - 1],
+                                                                 ntk, ps, portfolio_configuration(i)));
+            }
+        }
+        /**
+         * Evaluates whether a given aspect ratio can be skipped (see `smt_handler::skippable`).
+         *
+         * @param ar Aspect ratio to evaluate.
+         * @return `true` if ar can safely be skipped because it is UNSAT anyway.
+         */
+        [[nodiscard]] bool skippable(const typename Lyt::aspect_ratio& ar) const noexcept
+        {
+            return handlers.front()->skippable(ar);
+        }
+        /**
+         * Updates all handlers to the given aspect ratio (see `smt_handler::update`).
+         *
+         * @param ar Current aspect ratio to work on.
+         */
+        void update(const typename Lyt::aspect_ratio& ar) noexcept
+        {
+            for (auto& handler : handlers)
+            {
+                handler->update(ar);
+            }
+
+            winner = std::nullopt;
+            std::fill(failed.begin(), failed.end(), false);
+        }
+        /**
+         * Sets the given timeout for the current solvers of all handlers.
+         *
+         * @param t Timeout in ms.
+         */
+        void set_timeout(const unsigned t)
+        {
+            for (auto& handler : handlers)
+            {
+                handler->set_timeout(t);
+            }
+        }
+        /**
+         * Solves the current aspect ratio by racing all handlers. If the winning handler found the instance SAT, its
+         * layout is adopted.
+         *
+         * @return `true` iff the instance generated for the current configuration is SAT.
+         */
+        [[nodiscard]] bool is_satisfiable()
+        {
+            if (handlers.size() == 1)
+            {
+                const auto sat = handlers.front()->is_satisfiable();
+
+                if (sat || handlers.front()->is_unsatisfiable())
+                {
+                    winner = 0ul;
+                }
+
+                return sat;
+            }
+
+            race();
+
+            if (!winner.has_value() || handlers[*winner]->is_unsatisfiable())
+            {
+                return false;
+            }
+
+            if (*winner != 0)
+            {
+                layout = *member_layouts[*winner - 1];
+            }
+
+            return true;
+        }
+        /**
+         * Checks whether the last call to `is_satisfiable` proved the instance to be UNSAT.
+         *
+         * @return `true` iff the instance generated for the current configuration was proven to be UNSAT.
+         */
+        [[nodiscard]] bool is_unsatisfiable() const noexcept
+        {
+            return winner.has_value() && handlers[*winner]->is_unsatisfiable();
+        }
+        /**
+         * Stores the current solver states of all handlers in their solver trees with aspect ratio ar as key. Since
+         * the stored assertions do not depend on the solver's answer, the states of interrupted handlers are reused
+         * as well. Only handlers whose instance generation failed discard their states.
+         *
+         * @param ar Key to storing the current solver states.
+         */
+        void store_solver_state(const typename Lyt::aspect_ratio& ar) noexcept
+        {
+            for (std::size_t i = 0ul; i < handlers.size(); ++i)
+            {
+                if (!failed[i])
+                {
+                    handlers[i]->store_solver_state(ar);
+                }
+            }
+        }
+
+      private:
+        /**
+         * The contexts of all handlers.
+         */
+        const std::vector<ctx_ptr> contexts;
+        /**
+         * The layout that is going to contain the created layout.
+         */
+        Lyt& layout;
+        /**
+         * The layouts of all handlers but the first one, which uses `layout`.
+         */
+        std::vector<std::unique_ptr<Lyt>> member_layouts{};
+        /**
+         * The handlers, one per solver configuration.
+         */
+        std::vector<std::unique_ptr<smt_handler>> handlers{};
+        /**
+         * Index of the handler that gave the first conclusive answer for the current aspect ratio.
+         */
+        std::optional<std::size_t> winner{};
+        /**
+         * Flags that indicate that the respective handler threw an exception for the current aspect ratio.
+         */
+        std::vector<bool> failed;
+        /**
+         * Lets all handlers solve their current instances in parallel and stores the index of the first one that
+         * gives a conclusive answer in `winner`. All other handlers are interrupted thereafter.
+         */
+        void race()
+        {
+            std::mutex              mutex{};
+            std::condition_variable cv{};
+            std::vector<bool>       finished(handlers.size(), false);
+
+            const auto all_finished = [&finished]
+            { return std::all_of(finished.cbegin(), finished.cend(), [](const auto f) { return f; }); };
+
+            std::vector<std::thread> members{};
+            members.reserve(handlers.size());
+
+            for (std::size_t i = 0ul; i < handlers.size(); ++i)
+            {
+                members.emplace_back(
+                    [this, i, &mutex, &cv, &finished]
+                    {
+                        bool sat    = false;
+                        bool thrown = false;
+
+                        try
+                        {
+                            sat = handlers[i]->is_satisfiable();
+                        }
+                        catch (const z3::exception&)
+                        {
+                            thrown = true;
+                        }
+
+                        const std::lock_guard lock{mutex};
+
+                        finished[i] = true;
+                        failed[i]   = thrown;
+
+                        if (!winner.has_value() && (sat || handlers[i]->is_unsatisfiable()))
+                        {
+                            winner = i;
+                        }
+
+                        cv.notify_one();
+                    });
+            }
+
+            {
+                std::unique_lock lock{mutex};
+
+                cv.wait(lock, [this, &all_finished] { return winner.has_value() || all_finished(); });
+
+                // interrupts are lost if they arrive before a handler started solving; hence, they are repeated
+                while (!all_finished())
+                {
+                    for (std::size_t i = 0ul; i < handlers.size(); ++i)
+                    {
+                        if (!finished[i])
+                        {
+                            contexts[i]->interrupt();
+                        }
+                    }
+
+                    cv.wait_for(lock, std::chrono::milliseconds{1}, all_finished);
+                }
+            }
+
+            for (auto& member : members)
+            {
+                member.join();
+            }
+        }
+    };
 
     /**
      * Calculates the time left for solving by subtracting the time passed from the configured timeout and updates
      * Z3's timeout accordingly.
      *
-     * @param handler Handler whose timeout is to be updated.
+     * @param handler Portfolio whose timeouts are to be updated.
      * @param time Time passed since beginning of the solving process.
      */
-    void update_timeout(smt_handler& handler, const mockturtle::stopwatch<>::duration& time) const
+    void update_timeout(solver_portfolio& handler, const mockturtle::stopwatch<>::duration& time) const
     {
         const auto time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
         const auto time_left = (ps.timeout - time_elapsed > 0 ? static_cast<unsigned>(ps.timeout - time_elapsed) : 0u);
@@ -2796,235 +3502,285 @@ class exact_impl
         handler.set_timeout(time_left);
     }
     /**
-     * Contains a context pointer and a currently worked on aspect ratio and can be shared between multiple worker
-     * threads so that they can notify each other via context interrupts based on their individual results, i.e., a
-     * thread that found a result at aspect ratio x * y can interrupt all other threads that are working on larger
-     * layout sizes.
+     * Creates one context per solver configuration of the portfolio.
+     *
+     * @return Contexts for a solver portfolio of size `ps.portfolio_size`.
      */
-    struct thread_info
+    [[nodiscard]] std::vector<ctx_ptr> create_portfolio_contexts() const
+    {
+        std::vector<ctx_ptr> contexts{};
+
+        for (std::size_t i = 0ul; i < std::max(ps.portfolio_size, std::size_t{1}); ++i)
+        {
+            contexts.push_back(std::make_shared<z3::context>());
+        }
+
+        return contexts;
+    }
+    /**
+     * Shared state of the parallel exploration of aspect ratios. The aspect ratios form a work queue that is consumed
+     * by the worker threads in the order of the aspect ratio iterator, i.e., by increasing area. Each aspect ratio is
+     * identified by its position in this order, its job index. The layout of the satisfiable job with the smallest
+     * index is the result, which is thereby independent of the scheduling of the threads.
+     */
+    struct aspect_ratio_queue
     {
         /**
-         * Pointer to a context.
+         * Restricts access to all members and to the aspect ratio iterator.
          */
-        ctx_ptr ctx;
+        std::mutex mutex{};
         /**
-         * Currently examined layout aspect ratio.
+         * Notified whenever a worker stops solving a job.
          */
-        typename Lyt::aspect_ratio worker_aspect_ratio;
+        std::condition_variable job_finished{};
+        /**
+         * Index of the next job to hand out.
+         */
+        uint64_t next_job{0ull};
+        /**
+         * Index of the smallest satisfiable job found so far. Jobs of larger indices are cancelled.
+         */
+        uint64_t best_job{std::numeric_limits<uint64_t>::max()};
+        /**
+         * Layout of the smallest satisfiable job found so far.
+         */
+        std::optional<Lyt> best_layout{};
+        /**
+         * Flag that indicates that the upper bound was reached, i.e., that no further jobs exist.
+         */
+        bool exhausted{false};
+        /**
+         * Flag that indicates that a job could not be completed because the timeout was reached or an error occurred.
+         */
+        bool aborted{false};
+        /**
+         * Dimensions of the aspect ratios that were proven unsatisfiable.
+         */
+        std::vector<std::pair<uint64_t, uint64_t>> unsatisfiable{};
+        /**
+         * Contexts of the solver portfolio and index of the job that each worker is currently solving. The index is
+         * `std::nullopt` while the worker is not solving.
+         */
+        std::vector<std::pair<std::vector<ctx_ptr>, std::optional<uint64_t>>> running{};
+        /**
+         * Interrupts the solvers of all running jobs that satisfy the given predicate and waits until they are
+         * finished. Since interrupts are lost if they arrive before a solver started solving, they are repeated until
+         * all of these jobs are finished. `lock` has to hold `mutex` and is released while waiting such that the
+         * cancelled workers can finish their jobs.
+         *
+         * @tparam Predicate Type of the predicate.
+         * @param lock Lock that holds `mutex`.
+         * @param cancel Predicate that receives a job index and returns `true` iff the job is to be cancelled.
+         */
+        template <typename Predicate>
+        void cancel_jobs(std::unique_lock<std::mutex>& lock, Predicate&& cancel)
+        {
+            const auto all_cancelled = [this, &cancel]
+            {
+                return std::none_of(running.cbegin(), running.cend(),
+                                    [&cancel](const auto& r) { return r.second.has_value() && cancel(*r.second); });
+            };
+
+            while (!all_cancelled())
+            {
+                for (const auto& [ctxs, running_job] : running)
+                {
+                    if (running_job.has_value() && cancel(*running_job))
+                    {
+                        std::for_each(ctxs.cbegin(), ctxs.cend(), [](const auto& ctx) { ctx->interrupt(); });
+                    }
+                }
+
+                job_finished.wait_for(lock, std::chrono::milliseconds{1}, all_cancelled);
+            }
+        }
     };
     /**
-     * Thread function for the asynchronous solving strategy. It registers its own context in the given list of
-     * thread_info objects and starts exploring the search space. It fetches the next aspect ratio to work on from the
-     * global aspect ratio iterator which is protected by a mutex. When a result is found, other threads that are
-     * currently working on larger layout aspect ratios are interrupted while smaller ones may finish running.
+     * Thread function for the parallel solving strategy. The worker repeatedly takes the next job from the shared queue
+     * and solves it using its own solver portfolio. Since jobs are handed out by increasing index, the worker stops
+     * once it receives a job whose index exceeds the one of a satisfiable job. If the worker finds a satisfiable job,
+     * it cancels the running jobs of larger index, whereas jobs of smaller index keep running because they could yield
+     * a smaller layout.
      *
-     * @param t_num Thread's identifier.
-     * @param ti_list Pointer to a list of shared thread info that the threads use for communication.
-     * @return A found layout or nullptr if being interrupted.
+     * @param worker Worker's identifier.
+     * @param queue Shared queue of aspect ratios.
+     * @param start Point in time at which the solving process started.
      */
-    [[nodiscard]] std::optional<Lyt> explore_asynchronously(const unsigned                                   t_num,
-                                                            const std::shared_ptr<std::vector<thread_info>>& ti_list)
+    void explore_asynchronously(const std::size_t worker, aspect_ratio_queue& queue,
+                                const std::chrono::steady_clock::time_point start)
     {
-        const auto ctx = std::make_shared<z3::context>();
-
         Lyt layout{{}, *ps.scheme};
 
-        smt_handler handler{
-            ctx,
-            layout,
-            *ntk,
-            ps,
-        };
-        (*ti_list)[t_num].ctx = ctx;
+        solver_portfolio handler{queue.running[worker].first, layout, *ntk, ps};
 
         while (true)
         {
             typename Lyt::aspect_ratio ar;
+            uint64_t                   job{};
 
-            // mutually exclusive access to the aspect ratio iterator
+            // fetch the next job
             {
-                std::lock_guard<std::mutex> guard(ari_mutex);
+                const std::lock_guard lock{queue.mutex};
 
-                ++ari;
-                ar = *ari;  // operations ++ and * are split to prevent a vector copy construction
+                if (queue.aborted || queue.exhausted)
+                {
+                    return;
+                }
+                if (!(ari <= max_area))
+                {
+                    queue.exhausted = true;
 
-                // log the examination of a new aspect ratio
-                pst.num_aspect_ratios++;
-            }
+                    return;
+                }
 
-            if (ar.x >= ps.upper_bound_x && ar.y >= ps.upper_bound_y)
-            {
-                return std::nullopt;
+                job = queue.next_job++;
+                ar  = *ari;
+                ++ari;
+
+                // all remaining jobs are larger than a satisfiable one
+                if (job > queue.best_job)
+                {
+                    return;
+                }
             }
 
-            if (handler.skippable(ar))
+            // the handler only reflects jobs that were completed by this worker, which were all UNSAT
+            if (handler.skippable(ar) || known_unsatisfiable(ar))
             {
                 continue;
             }
 
-            // mutually exclusive access to the result aspect ratio
             {
-                std::lock_guard<std::mutex> guard(rar_mutex);
+                const std::lock_guard lock{queue.mutex};
 
-                // a result is available already
-                if (result_aspect_ratio)
+                // a smaller job might have been found satisfiable in the meantime; since this job is not registered as
+                // running yet, it would not be cancelled
+                if (queue.aborted || job > queue.best_job)
                 {
-                    // stop working if its area is smaller or equal to the one currently at hand
-                    if (area(*result_aspect_ratio) <= area(ar))
-                    {
-                        return std::nullopt;
-                    }
+                    return;
                 }
+
+                queue.running[worker].second = job;
             }
 
-            // update aspect ratio in the thread_info list and the handler
-            (*ti_list)[t_num].worker_aspect_ratio = ar;
             handler.update(ar);
 
+            bool sat = false;
+
             try
             {
-                mockturtle::stopwatch stop{pst.time_total};
+                update_timeout(handler, std::chrono::steady_clock::now() - start);
 
-                if (handler.is_satisfiable())  // found a layout
-                {
-                    // mutually exclusive access to the result_aspect_ratio
-                    {
-                        std::lock_guard<std::mutex> guard(rar_mutex);
+                sat = handler.is_satisfiable();
+            }
+            catch (const z3::exception&)  // timed out or interrupted
+            {
+                // handled below as the instance was neither proven SAT nor UNSAT
+            }
 
-                        // update the result_aspect_ratio if there is none
-                        if (!result_aspect_ratio)
-                        {
-                            result_aspect_ratio = ar;
-                        }
-                        else  // or if the own one is smaller
-                        {
-                            if (area(*result_aspect_ratio) > area(ar))
-                            {
-                                result_aspect_ratio = ar;
-                            }
-                            else
-                            {
-                                return std::nullopt;
-                            }
-                        }
-                    }
+            std::unique_lock lock{queue.mutex};
 
-                    // interrupt other threads that are working on higher aspect ratios
-                    for (const auto& ti : *ti_list)
-                    {
-                        if (area(ar) <= area(ti.worker_aspect_ratio))
-                        {
-                            ti.ctx->interrupt();
-                        }
-                    }
+            queue.running[worker].second = std::nullopt;
+            queue.job_finished.notify_all();
 
-                    return layout;
+            if (sat)
+            {
+                if (job < queue.best_job)
+                {
+                    queue.best_job    = job;
+                    queue.best_layout = layout;
+                    queue.cancel_jobs(lock,
+                                      [&queue](const uint64_t running_job) { return running_job > queue.best_job; });
                 }
-                // no layout with this aspect ratio possible
-                // One could assume that interrupting other threads that are working on real smaller (not bigger
-                // in any dimension) layouts could be beneficial here. However, testing revealed that this code
-                // was hardly ever triggered and if it was, it impacted performance negatively because no solver
-                // state could be stored that could positively influence performance of later SMT calls
 
-                handler.store_solver_state(ar);
+                return;
             }
-            catch (const z3::exception&)  // timed out or interrupted
+
+            if (!handler.is_unsatisfiable())
             {
-                return std::nullopt;
+                // the job was cancelled because a smaller one is satisfiable
+                if (job > queue.best_job)
+                {
+                    return;
+                }
+
+                // the timeout was reached; hence, the optimality of any layout found cannot be guaranteed
+                queue.aborted = true;
+                queue.cancel_jobs(lock, [](const uint64_t) { return true; });
+
+                return;
             }
 
-            update_timeout(handler, pst.time_total);
-        }
+            queue.unsatisfiable.push_back(dimensions(ar));
 
-        // unreachable code, but compiler complains if it's not there
-        return std::nullopt;
+            handler.store_solver_state(ar);
+        }
     }
     /**
-     * Launches params.num_threads threads and evaluates their return statements.
+     * Explores the aspect ratios in parallel using `ps.num_threads` worker threads that share a queue of aspect
+     * ratios (see `aspect_ratio_queue`). The first layout in the order of the aspect ratio iterator is returned, i.e.,
+     * the same aspect ratio is found as by `run_synchronously`.
      *
      * @return A placed and routed gate-level layout or std::nullopt in case a timeout or an upper bound was reached.
      */
     [[nodiscard]] std::optional<Lyt> run_asynchronously()
     {
-        std::cout << "You have called an unstable beta feature that might crash." << std::endl;
-
-        Lyt layout{{}, *ps.scheme};
+        aspect_ratio_queue queue{};
 
         {
             mockturtle::stopwatch stop{pst.time_total};
 
-            using fut_layout = std::future<std::optional<Lyt>>;
-            std::vector<fut_layout> fut(ps.num_threads);
-
-            const auto ti_list = std::make_shared<std::vector<thread_info>>(ps.num_threads);
-
 #if (PROGRESS_BARS)
-            mockturtle::progress_bar thread_bar("[i] examining layout aspect ratios using {} threads");
-            thread_bar(ps.num_threads);
-
-            auto post_toggle = false;
-
-            mockturtle::progress_bar post_bar(
-                "[i] some layout has been found; waiting for threads examining smaller aspect ratios to terminate");
+            mockturtle::progress_bar bar("[i] examining layout aspect ratios using {} threads");
+            bar(ps.num_threads);
 #endif
 
-            for (auto i = 0u; i < ps.num_threads; ++i)
+            const auto start = std::chrono::steady_clock::now();
+
+            // each worker creates its SMT instances in its own contexts
+            for (std::size_t i = 0ul; i < ps.num_threads; ++i)
             {
-                fut[i] = std::async(std::launch::async, &exact_impl::explore_asynchronously, this, i, ti_list);
+                queue.running.emplace_back(create_portfolio_contexts(), std::nullopt);
             }
 
-            // wait for all tasks to finish running (can be made much prettier in C++20...)
-            for (auto still_running = true; still_running;)
+            std::vector<std::thread> workers{};
+            workers.reserve(ps.num_threads);
+
+            for (std::size_t i = 0ul; i < ps.num_threads; ++i)
             {
-                still_running = false;
-                for (auto i = 0u; i < ps.num_threads; ++i)
-                {
-                    using namespace std::chrono_literals;
-                    if (fut[i].wait_for(10ms) == std::future_status::timeout)
-                    {
-                        still_running = true;
-                    }
-#if (PROGRESS_BARS)
-                    else if (!post_toggle)
-                    {
-                        thread_bar.done();
-                        post_bar(true);
-                        post_toggle = true;
-                    }
-#endif
-                }
+                workers.emplace_back([this, i, &queue, start] { explore_asynchronously(i, queue, start); });
             }
 
-            if (result_aspect_ratio)
+            for (auto& worker : workers)
             {
-                const auto result_ar_val = *result_aspect_ratio;
-                // extract the layout from the futures
-                for (auto& f : fut)
-                {
-                    if (auto l = f.get(); l.has_value())
-                    {
-                        // in case multiple returned, get the actual winner
-                        if ((*l).x() == result_ar_val.x && (*l).y() == result_ar_val.y)
-                        {
-                            layout = *l;
-                        }
-                    }
-                }
+                worker.join();
             }
         }
 
-        if (result_aspect_ratio.has_value())
-        {
-            // statistical information
-            pst.x_size    = layout.x() + 1;
-            pst.y_size    = layout.y() + 1;
-            pst.num_gates = layout.num_gates();
-            pst.num_wires = layout.num_wires();
+        // the same number of aspect ratios is counted as in the synchronous case
+        pst.num_aspect_ratios =
+            static_cast<uint32_t>(queue.best_layout.has_value() ? queue.best_job + 1 : queue.next_job);
+
+        // jobs are completed in arbitrary order
+        std::sort(queue.unsatisfiable.begin(), queue.unsatisfiable.end());
+        pst.unsatisfiable_aspect_ratios = std::move(queue.unsatisfiable);
 
-            return layout;
+        // the anytime strategy accepts layouts whose optimality could not be proven
+        if (!queue.best_layout.has_value() || (queue.aborted && !ps.anytime))
+        {
+            return std::nullopt;
         }
 
-        return std::nullopt;
+        const auto& layout = *queue.best_layout;
+
+        // statistical information
+        pst.x_size    = layout.x() + 1;
+        pst.y_size    = layout.y() + 1;
+        pst.num_gates = layout.num_gates();
+        pst.num_wires = layout.num_wires();
+        pst.optimal   = !queue.aborted;
+
+        return layout;
     }
     /**
      * Does the same as explore_asynchronously but without thread synchronization overhead.
@@ -3035,10 +3791,12 @@ class exact_impl
     {
         Lyt layout{{}, *ps.scheme};
 
-        smt_handler handler{std::make_shared<z3::context>(), layout, *ntk, ps};
+        solver_portfolio handler{create_portfolio_contexts(), layout, *ntk, ps};
 
-        for (; ari <= static_cast<uint64_t>(ps.upper_bound_x) * static_cast<uint64_t>(ps.upper_bound_y);
-             ++ari)  // <= to prevent overflow
+        // flag that indicates that an aspect ratio could be neither proven SAT nor UNSAT
+        bool inconclusive = false;
+
+        for (; ari <= max_area; ++ari)  // <= to prevent overflow
         {
 
 #if (PROGRESS_BARS)
@@ -3050,7 +3808,7 @@ class exact_impl
             // log the examination of a new aspect ratio
             pst.num_aspect_ratios++;
 
-            if (handler.skippable(ar))
+            if (handler.skippable(ar) || known_unsatisfiable(ar))
             {
                 continue;
             }
@@ -3073,10 +3831,20 @@ class exact_impl
                     pst.y_size    = layout.y() + 1;
                     pst.num_gates = layout.num_gates();
                     pst.num_wires = layout.num_wires();
+                    pst.optimal   = !inconclusive;
 
                     return layout;
                 }
 
+                if (handler.is_unsatisfiable())
+                {
+                    pst.unsatisfiable_aspect_ratios.push_back(dimensions(ar));
+                }
+                else
+                {
+                    inconclusive = true;
+                }
+
                 handler.store_solver_state(ar);
 
                 update_timeout(handler, pst.time_total);
@@ -0,0 +1,746 @@
+#ifndef FICTION_EXACT_PHYSICAL_DESIGN_CACHE_HPP
+#define FICTION_EXACT_PHYSICAL_DESIGN_CACHE_HPP
+
+#if (FICTION_Z3_SOLVER)
+
+#include "fiction/algorithms/network_transformation/fanout_substitution.hpp"
+#include "fiction/algorithms/physical_design/exact.hpp"
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/networks/technology_network.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
+
+#include <fmt/format.h>
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/print.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Identifies a cached exact physical design result. Two runs of `exact` share a key if their specification networks
+ * are structurally identical after fanout substitution and if they use the same layout type and the same parameters
+ * that affect the result. Parameters that only affect the runtime, e.g., the number of threads, the portfolio size, or
+ * the timeout, are not part of the key.
+ */
+struct exact_physical_design_cache_key
+{
+    /**
+     * Description of the layout type and all result-affecting parameters.
+     */
+    std::string params{};
+    /**
+     * Structure of the fanout-substituted specification network including its I/O names.
+     */
+    std::string network{};
+
+    bool operator==(const exact_physical_design_cache_key& other) const noexcept
+    {
+        return params == other.params && network == other.network;
+    }
+};
+
+}  // namespace fiction
+
+namespace std
+{
+
+/**
+ * Provides a hash implementation for `fiction::exact_physical_design_cache_key`.
+ */
+template <>
+struct hash<fiction::exact_physical_design_cache_key>
+{
+    std::size_t operator()(const fiction::exact_physical_design_cache_key& key) const noexcept
+    {
+        std::size_t h = 0;
+        fiction::hash_combine(h, key.params, key.network);
+
+        return h;
+    }
+};
+
+}  // namespace std
+
+namespace fiction
+{
+
+/**
+ * This struct stores the parameters for the exact physical design cache.
+ */
+struct exact_physical_design_cache_params
+{
+    /**
+     * Directory of the on-disk store. If set, each result is additionally stored in a file in this directory such that
+     * it can be reused across program runs. The directory is created if it does not exist.
+     */
+    std::optional<std::filesystem::path> directory{};
+};
+/**
+ * A cache for exact physical design results. For each key, it stores the layout of minimal area if one was found and
+ * the dimensions of all aspect ratios that were proven unsatisfiable. The latter are skipped by later runs that could
+ * not be answered by a cached layout, e.g., because the previous runs timed out.
+ *
+ * Layouts are stored in a compact text format that lists the layout's dimensions, its clock numbers in case of open
+ * clocking, its synchronization elements, and its nodes in topological order, each with its tile, name, function, and
+ * fanin tiles. Results are held in memory and, optionally, in an on-disk store (see
+ * `exact_physical_design_cache_params`). Files of the on-disk store are named by the hash of their key, which is
+ * stored in the file as well such that hash collisions are detected.
+ *
+ * All member functions are thread-safe.
+ */
+class exact_physical_design_cache
+{
+  public:
+    /**
+     * Cached result of a key.
+     */
+    struct result
+    {
+        /**
+         * Layout of minimal area in the compact text format or `std::nullopt` if none is known.
+         */
+        std::optional<std::string> layout{};
+        /**
+         * Sorted dimensions (number of tiles in x and y direction) of the aspect ratios that are unsatisfiable.
+         */
+        std::vector<std::pair<uint64_t, uint64_t>> unsatisfiable_aspect_ratios{};
+    };
+    /**
+     * Standard constructor.
+     *
+     * @param ps Cache parameters.
+     */
+    explicit exact_physical_design_cache(const exact_physical_design_cache_params& ps = {}) : params{ps}
+    {
+        if (params.directory.has_value())
+        {
+            std::filesystem::create_directories(*params.directory);
+        }
+    }
+    /**
+     * Looks up the result of the given key in memory and, if it is not found there, in the on-disk store.
+     *
+     * @param key Key of the physical design run.
+     * @return The cached result or `nullptr` if there is none.
+     */
+    [[nodiscard]] std::shared_ptr<const result> lookup(const exact_physical_design_cache_key& key)
+    {
+        {
+            const std::shared_lock lock{mutex};
+
+            if (const auto it = results.find(key); it != results.cend())
+            {
+                ++num_hits;
+
+                return it->second;
+            }
+        }
+
+        if (auto res = load(key); res != nullptr)
+        {
+            const std::unique_lock lock{mutex};
+
+            ++num_hits;
+
+            return results.emplace(key, std::move(res)).first->second;
+        }
+
+        ++num_misses;
+
+        return nullptr;
+    }
+    /**
+     * Stores the given result in memory and, if configured, in the on-disk store. An existing result of the same key is
+     * replaced.
+     *
+     * @param key Key of the physical design run.
+     * @param res Result of the physical design run.
+     */
+    void store(const exact_physical_design_cache_key& key, result res)
+    {
+        auto shared_res = std::make_shared<const result>(std::move(res));
+
+        if (params.directory.has_value())
+        {
+            save(key, *shared_res);
+        }
+
+        const std::unique_lock lock{mutex};
+
+        results.insert_or_assign(key, std::move(shared_res));
+    }
+    /**
+     * Returns the number of results held in memory.
+     *
+     * @return Number of cached results.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::shared_lock lock{mutex};
+
+        return results.size();
+    }
+    /**
+     * Returns the number of successful lookups.
+     *
+     * @return Number of cache hits.
+     */
+    [[nodiscard]] uint64_t hits() const noexcept
+    {
+        return num_hits;
+    }
+    /**
+     * Returns the number of unsuccessful lookups.
+     *
+     * @return Number of cache misses.
+     */
+    [[nodiscard]] uint64_t misses() const noexcept
+    {
+        return num_misses;
+    }
+    /**
+     * Removes all results from memory. The on-disk store is left untouched.
+     */
+    void clear() noexcept
+    {
+        const std::unique_lock lock{mutex};
+
+        results.clear();
+    }
+
+  private:
+    /**
+     * Cache parameters.
+     */
+    const exact_physical_design_cache_params params;
+    /**
+     * Results held in memory.
+     */
+    std::unordered_map<exact_physical_design_cache_key, std::shared_ptr<const result>> results{};
+    /**
+     * Mutex that guards `results`.
+     */
+    mutable std::shared_mutex mutex{};
+    /**
+     * Number of cache hits.
+     */
+    std::atomic<uint64_t> num_hits{0};
+    /**
+     * Number of cache misses.
+     */
+    std::atomic<uint64_t> num_misses{0};
+    /**
+     * Version of the file format of the on-disk store.
+     */
+    static constexpr const char* FILE_HEADER = "fiction-exact-physical-design-cache 1";
+    /**
+     * Returns the path of the file that stores the result of the given key.
+     *
+     * @param key Key of the physical design run.
+     * @return Path of the corresponding file in the on-disk store.
+     */
+    [[nodiscard]] std::filesystem::path file_path(const exact_physical_design_cache_key& key) const
+    {
+        return *params.directory / fmt::format("{:016x}.exact", std::hash<exact_physical_design_cache_key>{}(key));
+    }
+    /**
+     * Serializes the given key. Both of its parts are prefixed by their length such that the key can be compared
+     * verbatim.
+     *
+     * @param key Key of the physical design run.
+     * @return String representation of `key`.
+     */
+    [[nodiscard]] static std::string serialize_key(const exact_physical_design_cache_key& key)
+    {
+        return fmt::format("{}\n{}\n{}{}\n{}", FILE_HEADER, key.params.size(), key.params, key.network.size(),
+                           key.network);
+    }
+    /**
+     * Writes the given result to the on-disk store. The file is written to a temporary location first and moved to its
+     * final location afterwards such that concurrent readers never observe partially written files.
+     *
+     * @param key Key of the physical design run.
+     * @param res Result of the physical design run.
+     */
+    void save(const exact_physical_design_cache_key& key, const result& res) const
+    {
+        const auto path     = file_path(key);
+        const auto tmp_path = std::filesystem::path{path}.concat(
+            fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id())));
+
+        {
+            std::ofstream file{tmp_path, std::ios::trunc};
+
+            if (!file.is_open())
+            {
+                return;
+            }
+
+            file << serialize_key(key) << res.unsatisfiable_aspect_ratios.size() << '\n';
+
+            for (const auto& [x, y] : res.unsatisfiable_aspect_ratios)
+            {
+                file << x << ' ' << y << '\n';
+            }
+
+            file << (res.layout.has_value() ? 1 : 0) << '\n';
+
+            if (res.layout.has_value())
+            {
+                file << *res.layout;
+            }
+        }
+
+        std::error_code ec{};
+        std::filesystem::rename(tmp_path, path, ec);
+    }
+    /**
+     * Reads the result of the given key from the on-disk store.
+     *
+     * @param key Key of the physical design run.
+     * @return The stored result or `nullptr` if there is none or if the file belongs to a different key.
+     */
+    [[nodiscard]] std::shared_ptr<const result> load(const exact_physical_design_cache_key& key) const
+    {
+        if (!params.directory.has_value())
+        {
+            return nullptr;
+        }
+
+        std::ifstream file{file_path(key)};
+
+        if (!file.is_open())
+        {
+            return nullptr;
+        }
+
+        const auto expected_key = serialize_key(key);
+
+        std::string stored_key(expected_key.size(), '\0');
+        file.read(stored_key.data(), static_cast<std::streamsize>(stored_key.size()));
+
+        // hash collision or a file of a different format version
+        if (!file || stored_key != expected_key)
+        {
+            return nullptr;
+        }
+
+        result res{};
+
+        std::size_t num_unsatisfiable = 0;
+        file >> num_unsatisfiable;
+
+        res.unsatisfiable_aspect_ratios.resize(num_unsatisfiable);
+
+        for (auto& [x, y] : res.unsatisfiable_aspect_ratios)
+        {
+            file >> x >> y;
+        }
+
+        int has_layout = 0;
+        file >> has_layout;
+
+        if (!file)
+        {
+            return nullptr;
+        }
+
+        if (has_layout != 0)
+        {
+            file.ignore();  // line break
+            res.layout = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        }
+
+        return std::make_shared<const result>(std::move(res));
+    }
+};
+
+namespace detail
+{
+
+/**
+ * Creates the cache key of an exact physical design run. The network is fanout-substituted in the same way as by
+ * `exact` and described by the functions and fanins of its gates as well as by its I/O names, which are restored in
+ * the resulting layout.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @tparam Ntk Logic network type.
+ * @param ntk The specification network.
+ * @param ps Parameters of the exact physical design run.
+ * @return The key of the run.
+ */
+template <typename Lyt, typename Ntk>
+[[nodiscard]] exact_physical_design_cache_key exact_cache_key(const Ntk&                               ntk,
+                                                              const exact_physical_design_params<Lyt>& ps)
+{
+    const auto substituted = fanout_substitution<mockturtle::names_view<technology_network>>(
+        ntk, {fanout_substitution_params::substitution_strategy::BREADTH, ps.scheme->max_out_degree, 1ul});
+
+    std::ostringstream network{};
+    network << std::quoted(substituted.get_network_name()) << '\n';
+
+    substituted.foreach_pi(
+        [&network, &substituted](const auto& pi)
+        {
+            const auto s = substituted.make_signal(pi);
+
+            network << "i " << pi << ' ' << std::quoted(substituted.has_name(s) ? substituted.get_name(s) : "")
+                    << '\n';
+        });
+    substituted.foreach_gate(
+        [&network, &substituted](const auto& n)
+        {
+            network << "g " << n << ' ' << kitty::to_hex(substituted.node_function(n));
+
+            substituted.foreach_fanin(n, [&network, &substituted](const auto& f)
+                                      { network << ' ' << substituted.get_node(f); });
+
+            network << '\n';
+        });
+    substituted.foreach_po(
+        [&network, &substituted](const auto& po, const auto i)
+        {
+            network << "o " << substituted.get_node(po) << ' '
+                    << std::quoted(substituted.has_output_name(i) ? substituted.get_output_name(i) : "") << '\n';
+        });
+
+    // the layout type's name is compiler-specific; entries are thus only shared among equally compiled binaries
+    auto params = fmt::format("{} {} {} {} {} {} {} {} {} {} {} {} {} {} {}", typeid(Lyt).name(), ps.scheme->name,
+                              static_cast<uint32_t>(ps.scheme->num_clocks), ps.upper_bound_x, ps.upper_bound_y,
+                              ps.fixed_size, ps.crossings, ps.io_pins, ps.border_io, ps.synchronization_elements,
+                              ps.straight_inverters, ps.desynchronize, ps.minimize_wires, ps.minimize_crossings,
+                              static_cast<uint32_t>(ps.technology_specifics));
+
+    return {std::move(params), network.str()};
+}
+/**
+ * Writes the given gate-level layout in the compact text format of the exact physical design cache.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param lyt The layout to serialize.
+ * @return String representation of `lyt`.
+ */
+template <typename Lyt>
+[[nodiscard]] std::string serialize_exact_layout(const Lyt& lyt)
+{
+    std::ostringstream os{};
+
+    const auto write_tile = [&os](const auto& t)
+    { os << ' ' << static_cast<int64_t>(t.x) << ' ' << static_cast<int64_t>(t.y) << ' ' << static_cast<int64_t>(t.z); };
+
+    os << static_cast<int64_t>(lyt.x()) << ' ' << static_cast<int64_t>(lyt.y()) << ' ' << static_cast<int64_t>(lyt.z())
+       << ' ' << std::quoted(lyt.get_layout_name()) << '\n';
+
+    // clock numbers only need to be stored if they were assigned individually
+    if (!lyt.is_regularly_clocked())
+    {
+        lyt.foreach_ground_tile(
+            [&os, &lyt, &write_tile](const auto& t)
+            {
+                os << 'c';
+                write_tile(t);
+                os << ' ' << static_cast<uint32_t>(lyt.get_clock_number(t)) << '\n';
+            });
+    }
+
+    if constexpr (has_synchronization_elements_v<Lyt>)
+    {
+        lyt.foreach_ground_tile(
+            [&os, &lyt, &write_tile](const auto& t)
+            {
+                if (const auto se = lyt.get_synchronization_element(t); se != 0)
+                {
+                    os << 's';
+                    write_tile(t);
+                    os << ' ' << static_cast<uint32_t>(se) << '\n';
+                }
+            });
+    }
+
+    // nodes are created in topological order
+    lyt.foreach_node(
+        [&os, &lyt, &write_tile](const auto& n)
+        {
+            if (lyt.is_constant(n))
+            {
+                return;
+            }
+
+            os << (lyt.is_pi(n) ? 'i' : lyt.is_po(n) ? 'o' : 'g');
+            write_tile(lyt.get_tile(n));
+            os << ' ' << std::quoted(lyt.get_name(n));
+
+            if (!lyt.is_pi(n) && !lyt.is_po(n))
+            {
+                os << ' ' << kitty::to_hex(lyt.node_function(n));
+            }
+
+            lyt.foreach_fanin(n, [&lyt, &write_tile](const auto& f) { write_tile(lyt.get_tile(lyt.get_node(f))); });
+
+            os << '\n';
+        });
+
+    return os.str();
+}
+/**
+ * Reads a gate-level layout from the compact text format of the exact physical design cache.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param str String representation of the layout.
+ * @param scheme Clocking scheme of the layout.
+ * @return The layout or `std::nullopt` if `str` is malformed.
+ */
+template <typename Lyt>
+[[nodiscard]] std::optional<Lyt> deserialize_exact_layout(const std::string&                        str,
+                                                          const clocking_scheme<typename Lyt::tile>& scheme)
+{
+    std::istringstream is{str};
+
+    const auto read_tile = [](std::istream& in) -> std::optional<typename Lyt::tile>
+    {
+        int64_t x = 0, y = 0, z = 0;
+
+        if (!(in >> x >> y >> z))
+        {
+            return std::nullopt;
+        }
+
+        return typename Lyt::tile{x, y, z};
+    };
+
+    const auto ar = read_tile(is);
+
+    std::string name{};
+
+    if (!ar.has_value() || !(is >> std::quoted(name)))
+    {
+        return std::nullopt;
+    }
+
+    Lyt layout{typename Lyt::aspect_ratio{ar->x, ar->y, ar->z}, scheme, name};
+
+    for (std::string line{}; std::getline(is, line);)
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        std::istringstream ls{line};
+
+        char kind = 0;
+        ls >> kind;
+
+        const auto t = read_tile(ls);
+
+        if (!t.has_value())
+        {
+            return std::nullopt;
+        }
+
+        if (kind == 'c' || kind == 's')
+        {
+            uint32_t value = 0;
+
+            if (!(ls >> value))
+            {
+                return std::nullopt;
+            }
+
+            if (kind == 'c')
+            {
+                layout.assign_clock_number(*t, static_cast<typename Lyt::clock_number_t>(value));
+                layout.assign_clock_number(layout.above(*t), static_cast<typename Lyt::clock_number_t>(value));
+            }
+            else if constexpr (has_synchronization_elements_v<Lyt>)
+            {
+                layout.assign_synchronization_element(*t, static_cast<typename Lyt::sync_elem_t>(value));
+            }
+
+            continue;
+        }
+
+        std::string node_name{};
+        std::string function{};
+
+        if (!(ls >> std::quoted(node_name)) || (kind == 'g' && !(ls >> function)))
+        {
+            return std::nullopt;
+        }
+
+        std::vector<mockturtle::signal<Lyt>> fanins{};
+
+        for (auto f = read_tile(ls); f.has_value(); f = read_tile(ls))
+        {
+            fanins.push_back(layout.make_signal(layout.get_node(*f)));
+        }
+
+        if (kind == 'i')
+        {
+            layout.create_pi(node_name, *t);
+        }
+        else if (kind == 'o' && fanins.size() == 1)
+        {
+            layout.create_po(fanins.front(), node_name, *t);
+        }
+        else if (kind == 'g' && !fanins.empty())
+        {
+            kitty::dynamic_truth_table tt{static_cast<uint32_t>(fanins.size())};
+            kitty::create_from_hex_string(tt, function);
+
+            layout.create_node(fanins, tt, *t);
+
+            if (!node_name.empty())
+            {
+                layout.set_name(layout.get_node(*t), node_name);
+            }
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    return layout;
+}
+
+}  // namespace detail
+
+/**
+ * Exact physical design (see exact.hpp) whose results are memoized in the given cache. If the cache holds a layout of
+ * minimal area for a structurally identical specification network under the same parameters, it is returned right
+ * away. Otherwise, `exact` is run, skipping all aspect ratios that are known to be unsatisfiable from previous runs.
+ * Afterwards, the newly proven unsatisfiable aspect ratios and, if its minimality was proven, the resulting layout are
+ * added to the cache. Hence, a run that timed out still speeds up later ones.
+ *
+ * Runs with a black list are not cached since the black list is not part of the key.
+ *
+ * @tparam Lyt Desired gate-level layout type.
+ * @tparam Ntk Network type that acts as specification.
+ * @param ntk The network that is to place and route.
+ * @param ps Parameters of the exact physical design algorithm.
+ * @param cache Cache of exact physical design results.
+ * @param pst Statistics. If the layout is taken from the cache, `time_total` refers to the time required to restore
+ * it and `num_aspect_ratios` is `0`.
+ * @return A gate-level layout of type `Lyt` that implements `ntk` as an FCN circuit if one is found under the given
+ * parameters; `std::nullopt`, otherwise.
+ */
+template <typename Lyt, typename Ntk>
+std::optional<Lyt> cached_exact(const Ntk& ntk, const exact_physical_design_params<Lyt>& ps,
+                                exact_physical_design_cache& cache, exact_physical_design_stats* pst = nullptr)
+{
+    if (!ps.black_list.empty() || has_high_degree_fanin_nodes(ntk, ps.scheme->max_in_degree))
+    {
+        return exact<Lyt>(ntk, ps, pst);
+    }
+
+    exact_physical_design_stats st{};
+
+    const auto key    = detail::exact_cache_key(ntk, ps);
+    const auto cached = cache.lookup(key);
+
+    if (cached != nullptr && cached->layout.has_value())
+    {
+        std::optional<Lyt> layout{};
+
+        {
+            mockturtle::stopwatch stop{st.time_total};
+
+            layout = detail::deserialize_exact_layout<Lyt>(*cached->layout, *ps.scheme);
+        }
+
+        if (layout.has_value())
+        {
+            // statistical information
+            st.x_size    = layout->x() + 1;
+            st.y_size    = layout->y() + 1;
+            st.num_gates = layout->num_gates();
+            st.num_wires = layout->num_wires();
+            st.optimal   = true;
+
+            if (pst)
+            {
+                *pst = st;
+            }
+
+            return layout;
+        }
+    }
+
+    auto cached_ps = ps;
+
+    if (cached != nullptr)
+    {
+        cached_ps.unsatisfiable_aspect_ratios.insert(cached_ps.unsatisfiable_aspect_ratios.cend(),
+                                                     cached->unsatisfiable_aspect_ratios.cbegin(),
+                                                     cached->unsatisfiable_aspect_ratios.cend());
+    }
+
+    auto layout = exact<Lyt>(ntk, cached_ps, &st);
+
+    exact_physical_design_cache::result res{};
+
+    res.unsatisfiable_aspect_ratios = st.unsatisfiable_aspect_ratios;
+
+    if (cached != nullptr)
+    {
+        res.unsatisfiable_aspect_ratios.insert(res.unsatisfiable_aspect_ratios.cend(),
+                                               cached->unsatisfiable_aspect_ratios.cbegin(),
+                                               cached->unsatisfiable_aspect_ratios.cend());
+    }
+
+    std::sort(res.unsatisfiable_aspect_ratios.begin(), res.unsatisfiable_aspect_ratios.end());
+    res.unsatisfiable_aspect_ratios.erase(
+        std::unique(res.unsatisfiable_aspect_ratios.begin(), res.unsatisfiable_aspect_ratios.end()),
+        res.unsatisfiable_aspect_ratios.cend());
+
+    if (layout.has_value() && st.optimal)
+    {
+        res.layout = detail::serialize_exact_layout(*layout);
+    }
+
+    if (res.layout.has_value() || res.unsatisfiable_aspect_ratios.size() >
+                                      (cached != nullptr ? cached->unsatisfiable_aspect_ratios.size() : 0ul))
+    {
+        cache.store(key, std::move(res));
+    }
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return layout;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_Z3_SOLVER
+
+#endif  // FICTION_EXACT_PHYSICAL_DESIGN_CACHE_HPP
@@ -0,0 +1,445 @@
+#ifndef FICTION_BRANCH_AND_BOUND_GROUND_STATE_SIMULATION_HPP
+#define FICTION_BRANCH_AND_BOUND_GROUND_STATE_SIMULATION_HPP
+
+#include "fiction/algorithms/simulation/sidb/energy_statistics.hpp"
+#include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/physical_constants.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/traits.hpp"
+
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace fiction
+{
+
+namespace detail
+{
+
+template <typename Lyt>
+class branch_and_bound_ground_state_simulation_impl
+{
+  public:
+    branch_and_bound_ground_state_simulation_impl(const Lyt& lyt, const sidb_simulation_parameters& p,
+                                                  exgs_stats<Lyt>& st) :
+            charge_lyt{lyt, p},
+            params{p},
+            pst{st},
+            num_sidbs{charge_lyt.num_cells()}
+    {}
+
+    void run()
+    {
+        mockturtle::stopwatch stop{pst.time_total};
+
+        if (num_sidbs == 0)
+        {
+            return;
+        }
+
+        initialize();
+
+        search(0);
+
+        // drop charge distributions that were stored before a charge distribution with a lower energy was found
+        std::vector<charge_distribution_surface<Lyt>> ground_states{};
+
+        for (const auto& lyt : pst.valid_lyts)
+        {
+            if (lyt.get_system_energy() <= best_energy + physical_constants::POP_STABILITY_ERR)
+            {
+                ground_states.emplace_back(lyt);
+            }
+        }
+
+        pst.valid_lyts.swap(ground_states);
+
+        sort_by_charge_index(pst.valid_lyts);
+
+        pst.energy_statistics = sidb_energy_statistics<Lyt>{pst.valid_lyts.size()};
+
+        for (const auto& lyt : pst.valid_lyts)
+        {
+            pst.energy_statistics.add(lyt);
+        }
+    }
+
+  private:
+    /**
+     * Charge distribution surface that is used to check the configuration stability of complete assignments.
+     */
+    charge_distribution_surface<Lyt> charge_lyt;
+    /**
+     * Physical parameters.
+     */
+    const sidb_simulation_parameters params;
+    /**
+     * Statistics.
+     */
+    exgs_stats<Lyt>& pst;
+    /**
+     * Number of SiDBs in the layout.
+     */
+    const uint64_t num_sidbs;
+    /**
+     * Order in which charge states are assigned to the SiDBs.
+     */
+    std::vector<uint64_t> order{};
+    /**
+     * Charge signs that can be assigned to an SiDB in the order they are tried.
+     */
+    std::vector<int8_t> signs{};
+    /**
+     * Charge sign of each SiDB. Only meaningful for SiDBs that are already assigned.
+     */
+    std::vector<int8_t> charge_signs{};
+    /**
+     * Flags indicating which SiDBs are already assigned.
+     */
+    std::vector<bool> assigned{};
+    /**
+     * Local potential of each SiDB caused by the assigned SiDBs and by external charges, e.g., charged defects.
+     */
+    std::vector<double> fixed_potential{};
+    /**
+     * Lower bound of the local potential of each SiDB that can still be caused by the unassigned SiDBs.
+     */
+    std::vector<double> min_remaining_potential{};
+    /**
+     * Upper bound of the local potential of each SiDB that can still be caused by the unassigned SiDBs.
+     */
+    std::vector<double> max_remaining_potential{};
+    /**
+     * Sum of the potentials between all pairs of SiDBs that are unassigned at the given search depth.
+     */
+    std::vector<double> unassigned_pair_potential{};
+    /**
+     * Electrostatic energy among the assigned SiDBs.
+     */
+    double fixed_energy{0.0};
+    /**
+     * Energy of the lowest-energy physically valid charge distribution found so far.
+     */
+    double best_energy{std::numeric_limits<double>::max()};
+
+    /**
+     * Sets up the search. SiDBs that interact strongly with the remaining layout are assigned first since they
+     * tighten the potential bounds of all other SiDBs the most.
+     */
+    void initialize()
+    {
+        signs = {-1, 0};
+
+        if (params.base == 3)
+        {
+            signs.push_back(1);
+        }
+
+        std::vector<double> total_potential(num_sidbs, 0.0);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            for (uint64_t j = 0; j < num_sidbs; ++j)
+            {
+                total_potential[i] += charge_lyt.get_electrostatic_potential_by_indices(i, j);
+            }
+        }
+
+        order.resize(num_sidbs);
+        std::iota(order.begin(), order.end(), uint64_t{0});
+        std::stable_sort(order.begin(), order.end(), [&total_potential](const auto lhs, const auto rhs)
+                         { return total_potential[lhs] > total_potential[rhs]; });
+
+        charge_signs.assign(num_sidbs, 0);
+        assigned.assign(num_sidbs, false);
+
+        // the potential of external charges, e.g., charged defects, is fixed from the start
+        fixed_potential.resize(num_sidbs);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            fixed_potential[i] = charge_lyt.get_external_potential_by_index(i);
+        }
+
+        min_remaining_potential.resize(num_sidbs);
+        max_remaining_potential.resize(num_sidbs);
+
+        // unassigned SiDBs can be negative, i.e., lower the potential, or, in three-state simulation, positive
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            min_remaining_potential[i] = -total_potential[i];
+            max_remaining_potential[i] = params.base == 3 ? total_potential[i] : 0.0;
+        }
+
+        unassigned_pair_potential.assign(num_sidbs + 1, 0.0);
+
+        for (auto depth = num_sidbs; depth-- > 0;)
+        {
+            unassigned_pair_potential[depth] = unassigned_pair_potential[depth + 1];
+
+            for (auto other = depth + 1; other < num_sidbs; ++other)
+            {
+                unassigned_pair_potential[depth] +=
+                    charge_lyt.get_electrostatic_potential_by_indices(order[depth], order[other]);
+            }
+        }
+    }
+    /**
+     * Checks whether an SiDB with the given charge sign can fulfill the population stability if its local potential
+     * lies within the given interval.
+     *
+     * @param sign Charge sign of the SiDB.
+     * @param min_potential Lower bound of the local potential.
+     * @param max_potential Upper bound of the local potential.
+     * @return `true` iff the population stability can be fulfilled.
+     */
+    [[nodiscard]] bool is_population_stability_reachable(const int8_t sign, const double min_potential,
+                                                         const double max_potential) const noexcept
+    {
+        switch (sign)
+        {
+            case -1:
+            {
+                return -max_potential + params.mu < physical_constants::POP_STABILITY_ERR;
+            }
+            case 1:
+            {
+                return -min_potential + params.mu_p > -physical_constants::POP_STABILITY_ERR;
+            }
+            default:
+            {
+                return (-min_potential + params.mu > -physical_constants::POP_STABILITY_ERR) &&
+                       (-max_potential + params.mu_p < physical_constants::POP_STABILITY_ERR);
+            }
+        }
+    }
+    /**
+     * Checks whether the given SiDB can still fulfill the population stability in its assigned charge state or, if it
+     * is unassigned, in at least one charge state.
+     *
+     * @param i Index of the SiDB.
+     * @return `true` iff the population stability can be fulfilled.
+     */
+    [[nodiscard]] bool is_population_stability_reachable(const uint64_t i) const noexcept
+    {
+        const auto min_potential = fixed_potential[i] + min_remaining_potential[i];
+        const auto max_potential = fixed_potential[i] + max_remaining_potential[i];
+
+        if (assigned[i])
+        {
+            return is_population_stability_reachable(charge_signs[i], min_potential, max_potential);
+        }
+
+        return std::any_of(signs.cbegin(), signs.cend(), [this, min_potential, max_potential](const auto sign)
+                           { return is_population_stability_reachable(sign, min_potential, max_potential); });
+    }
+    /**
+     * Determines whether the current partial assignment can be pruned. This is the case if at least one SiDB cannot
+     * fulfill the population stability anymore or if a lower bound of the energy of all completions exceeds the
+     * energy of the best charge distribution found so far. The bound consists of the exact energy among the assigned
+     * SiDBs, the most favorable interaction of each unassigned SiDB with the assigned ones, and the most favorable
+     * interaction among the unassigned SiDBs.
+     *
+     * @param depth Number of assigned SiDBs.
+     * @return `true` iff the partial assignment can be pruned.
+     */
+    [[nodiscard]] bool is_prunable(const uint64_t depth) const noexcept
+    {
+        auto lower_bound = fixed_energy;
+
+        if (params.base == 3)
+        {
+            lower_bound -= unassigned_pair_potential[depth];
+        }
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            if (!is_population_stability_reachable(i))
+            {
+                return true;
+            }
+
+            if (!assigned[i])
+            {
+                const auto min_potential = fixed_potential[i] + min_remaining_potential[i];
+                const auto max_potential = fixed_potential[i] + max_remaining_potential[i];
+
+                auto min_interaction = std::numeric_limits<double>::max();
+
+                for (const auto sign : signs)
+                {
+                    if (is_population_stability_reachable(sign, min_potential, max_potential))
+                    {
+                        min_interaction = std::min(min_interaction, sign * fixed_potential[i]);
+                    }
+                }
+
+                lower_bound += min_interaction;
+            }
+        }
+
+        return lower_bound > best_energy + physical_constants::POP_STABILITY_ERR;
+    }
+    /**
+     * Assigns the given charge sign to an unassigned SiDB and updates the potential bounds of all SiDBs.
+     *
+     * @param k Index of the SiDB.
+     * @param sign Charge sign to assign.
+     */
+    void assign(const uint64_t k, const int8_t sign) noexcept
+    {
+        fixed_energy += sign * fixed_potential[k];
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            const auto potential = charge_lyt.get_electrostatic_potential_by_indices(i, k);
+
+            fixed_potential[i] += potential * sign;
+            min_remaining_potential[i] += potential;
+
+            if (params.base == 3)
+            {
+                max_remaining_potential[i] -= potential;
+            }
+        }
+
+        charge_signs[k] = sign;
+        assigned[k]     = true;
+    }
+    /**
+     * Reverts `assign`.
+     *
+     * @param k Index of the SiDB.
+     * @param sign Charge sign that was assigned.
+     */
+    void unassign(const uint64_t k, const int8_t sign) noexcept
+    {
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            const auto potential = charge_lyt.get_electrostatic_potential_by_indices(i, k);
+
+            fixed_potential[i] -= potential * sign;
+            min_remaining_potential[i] -= potential;
+
+            if (params.base == 3)
+            {
+                max_remaining_potential[i] += potential;
+            }
+        }
+
+        fixed_energy -= sign * fixed_potential[k];
+
+        charge_signs[k] = 0;
+        assigned[k]     = false;
+    }
+    /**
+     * Checks the configuration stability of a complete, population-stable assignment and stores it if its energy does
+     * not exceed the lowest energy found so far.
+     */
+    void evaluate_complete_assignment()
+    {
+        if (fixed_energy > best_energy + physical_constants::POP_STABILITY_ERR)
+        {
+            return;
+        }
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            charge_lyt.assign_charge_state_by_cell_index(i, sign_to_charge_state(charge_signs[i]), false);
+        }
+
+        charge_lyt.update_after_charge_change();
+
+        if (charge_lyt.is_physically_valid())
+        {
+            best_energy = std::min(best_energy, charge_lyt.get_system_energy());
+
+            charge_lyt.charge_distribution_to_index();
+            pst.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+        }
+    }
+    /**
+     * Recursively assigns charge states to the SiDBs in the determined order.
+     *
+     * @param depth Number of assigned SiDBs.
+     */
+    void search(const uint64_t depth)
+    {
+        if (depth == num_sidbs)
+        {
+            evaluate_complete_assignment();
+
+            return;
+        }
+
+        const auto k = order[depth];
+
+        for (const auto sign : signs)
+        {
+            if (!is_population_stability_reachable(sign, fixed_potential[k] + min_remaining_potential[k],
+                                                   fixed_potential[k] + max_remaining_potential[k]))
+            {
+                continue;
+            }
+
+            assign(k, sign);
+
+            if (!is_prunable(depth + 1))
+            {
+                search(depth + 1);
+            }
+
+            unassign(k, sign);
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Exact ground state simulation of an SiDB layout by means of branch and bound. Charge states are assigned SiDB by SiDB
+ * and partial assignments are discarded if at least one SiDB can no longer fulfill the population stability, given
+ * bounds of its local potential, or if a lower bound of the system energy of all completions exceeds the energy of the
+ * best physically valid charge distribution found so far. Thereby, large parts of the \f$ 2^n \f$ or \f$ 3^n \f$
+ * charge distributions are never visited.
+ *
+ * In contrast to `exhaustive_ground_state_simulation`, only the ground state, i.e., the physically valid charge
+ * distribution(s) of lowest energy, is stored in `valid_lyts` in ascending order of the charge index. Likewise,
+ * `energy_statistics` only covers the ground state. The returned statistics can hence be used as the exact reference
+ * for, e.g., `is_ground_state`.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param params Simulation parameters.
+ * @param ps Simulation statistics.
+ */
+template <typename Lyt>
+void branch_and_bound_ground_state_simulation(const Lyt&                        lyt,
+                                              const sidb_simulation_parameters& params = sidb_simulation_parameters{},
+                                              exgs_stats<Lyt>*                  ps     = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    exgs_stats<Lyt> st{};
+
+    detail::branch_and_bound_ground_state_simulation_impl<Lyt> p{lyt, params, st};
+
+    p.run();
+
+    if (ps)
+    {
+        *ps = st;
+    }
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_BRANCH_AND_BOUND_GROUND_STATE_SIMULATION_HPP
@@ -6,6 +6,7 @@
 #define FICTION_ENERGY_DISTRIBUTION_HPP
 
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -42,6 +43,32 @@ std::map<double, uint64_t> energy_distribution(const std::vector<charge_distribu
 
     return distribution;
 }
+/**
+ * This function takes in compactly stored charge distributions and returns a map containing the system energy and the
+ * number of occurrences of that energy in the input collection.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param charge_lyts Compactly stored charge distributions for which statistics are to be computed.
+ * @return A map containing the system energy as the key and the number of occurrences of that energy in the input
+ * collection as the value.
+ */
+template <typename Lyt>
+std::map<double, uint64_t> energy_distribution(const compact_charge_distributions<Lyt>& charge_lyts) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    std::map<double, uint64_t> distribution{};
+
+    for (const auto& entry : charge_lyts)
+    {
+        const auto energy = std::round(entry.system_energy * 1'000'000) / 1'000'000;  // rounding to 6 decimal places.
+
+        distribution[energy]++;
+    }
+
+    return distribution;
+}
 
 }  // namespace fiction
 
@@ -0,0 +1,365 @@
+#ifndef FICTION_ENERGY_STATISTICS_HPP
+#define FICTION_ENERGY_STATISTICS_HPP
+
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
+#include "fiction/traits.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Streaming counterpart of `energy_distribution`. It counts the occurrences of system energies, rounded to 6 decimal
+ * places, one charge distribution at a time such that the charge distributions need not be retained.
+ */
+class energy_histogram
+{
+  public:
+    /**
+     * Counts the given system energy.
+     *
+     * @param energy System energy of a charge distribution.
+     */
+    void add(const double energy)
+    {
+        ++histogram[round(energy)];
+        ++total;
+    }
+    /**
+     * Adds all counts of another histogram.
+     *
+     * @param other Histogram to merge.
+     */
+    void merge(const energy_histogram& other)
+    {
+        for (const auto& [energy, count] : other.histogram)
+        {
+            histogram[energy] += count;
+        }
+
+        total += other.total;
+    }
+    /**
+     * Returns the energy distribution in the format of `energy_distribution`.
+     *
+     * @return A map containing the rounded system energy as the key and the number of its occurrences as the value.
+     */
+    [[nodiscard]] const std::map<double, uint64_t>& get_distribution() const noexcept
+    {
+        return histogram;
+    }
+    /**
+     * Returns the number of counted system energies.
+     *
+     * @return Number of counted system energies.
+     */
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+        return total;
+    }
+    /**
+     * Checks whether no system energy was counted.
+     *
+     * @return `true` iff no system energy was counted.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return total == 0;
+    }
+    /**
+     * Rounds the given energy to 6 decimal places as done by `energy_distribution`.
+     *
+     * @param energy Energy to round.
+     * @return Rounded energy.
+     */
+    [[nodiscard]] static double round(const double energy) noexcept
+    {
+        return std::round(energy * 1'000'000) / 1'000'000;
+    }
+
+  private:
+    /**
+     * Number of occurrences per rounded system energy.
+     */
+    std::map<double, uint64_t> histogram{};
+    /**
+     * Total number of counted system energies.
+     */
+    uint64_t total{0};
+};
+/**
+ * Streaming counterpart of `minimum_energy`.
+ */
+class running_minimum_energy
+{
+  public:
+    /**
+     * Updates the minimum with the given system energy.
+     *
+     * @param energy System energy of a charge distribution.
+     */
+    void add(const double energy) noexcept
+    {
+        minimum = std::min(minimum, energy);
+    }
+    /**
+     * Updates the minimum with that of another accumulator.
+     *
+     * @param other Accumulator to merge.
+     */
+    void merge(const running_minimum_energy& other) noexcept
+    {
+        add(other.minimum);
+    }
+    /**
+     * Returns the minimum energy. As for `minimum_energy`, it is the largest representable value if no energy was
+     * added.
+     *
+     * @return Minimum of all added system energies.
+     */
+    [[nodiscard]] double get_value() const noexcept
+    {
+        return minimum;
+    }
+
+  private:
+    /**
+     * Minimum of all added system energies.
+     */
+    double minimum{std::numeric_limits<double>::max()};
+};
+/**
+ * Retains the `k` charge distributions with the lowest system energies out of all charge distributions that are added
+ * one at a time. They are kept in a bounded max-heap of compactly stored charge distributions, i.e., adding a charge
+ * distribution takes \f$ O(\log k) \f$ time if it is among the lowest ones and \f$ O(1) \f$ otherwise. Identical charge
+ * distributions are retained only once. Charge distributions whose rounded system energies are equal (see
+ * `energy_histogram::round`) are ordered by their charge states such that the result does not depend on the order in
+ * which they are added, e.g., by several threads.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ */
+template <typename Lyt>
+class lowest_energy_states
+{
+  public:
+    using entry = typename compact_charge_distributions<Lyt>::entry;
+    /**
+     * Standard constructor.
+     *
+     * @param k Maximum number of charge distributions to retain.
+     */
+    explicit lowest_energy_states(const uint64_t k = 1) noexcept : capacity{k} {}
+    /**
+     * Retains the given charge distribution if it is among the `k` lowest ones added so far. Unless retained ones exist
+     * already, it serves as the physical model of all subsequent ones, which must therefore be based on the same layout
+     * and physical parameters.
+     *
+     * @param charge_lyt Charge distribution surface to add.
+     */
+    void add(const charge_distribution_surface<Lyt>& charge_lyt)
+    {
+        if (capacity == 0)
+        {
+            return;
+        }
+
+        const auto energy = charge_lyt.get_system_energy();
+
+        // most charge distributions are rejected before their charge states are packed
+        if (heap.size() == capacity &&
+            energy_histogram::round(energy) > energy_histogram::round(heap.front().system_energy))
+        {
+            return;
+        }
+
+        if (!model)
+        {
+            model = std::make_shared<const charge_distribution_surface<Lyt>>(charge_lyt);
+        }
+
+        charge_lyt.charge_distribution_to_index();
+
+        add(entry{packed_charge_distribution{charge_lyt.get_all_sidb_charges()}, energy,
+                  charge_lyt.is_physically_valid(), charge_lyt.get_charge_index().first});
+    }
+    /**
+     * Retains the lowest charge distributions of another accumulator that shares the same physical model.
+     *
+     * @param other Accumulator to merge.
+     */
+    void merge(const lowest_energy_states<Lyt>& other)
+    {
+        if (!model)
+        {
+            model = other.model;
+        }
+
+        for (const auto& e : other.heap)
+        {
+            add(e);
+        }
+    }
+    /**
+     * Returns the retained charge distributions in ascending order of their system energies.
+     *
+     * @return Compactly stored charge distributions that can be materialized on demand.
+     */
+    [[nodiscard]] compact_charge_distributions<Lyt> get_states() const
+    {
+        auto sorted = heap;
+        std::sort_heap(sorted.begin(), sorted.end(), less);
+
+        compact_charge_distributions<Lyt> states{model};
+
+        for (const auto& e : sorted)
+        {
+            states.add(e);
+        }
+
+        return states;
+    }
+    /**
+     * Returns the number of retained charge distributions.
+     *
+     * @return Number of retained charge distributions.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return heap.size();
+    }
+    /**
+     * Returns the maximum number of retained charge distributions.
+     *
+     * @return `k`.
+     */
+    [[nodiscard]] uint64_t get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+  private:
+    /**
+     * Maximum number of retained charge distributions.
+     */
+    uint64_t capacity;
+    /**
+     * Max-heap of the retained charge distributions with respect to `less`.
+     */
+    std::vector<entry> heap{};
+    /**
+     * Shared physical model.
+     */
+    std::shared_ptr<const charge_distribution_surface<Lyt>> model{nullptr};
+
+    /**
+     * Strict weak ordering of charge distributions by their rounded system energies and their charge states.
+     */
+    static bool less(const entry& lhs, const entry& rhs) noexcept
+    {
+        const auto lhs_energy = energy_histogram::round(lhs.system_energy);
+        const auto rhs_energy = energy_histogram::round(rhs.system_energy);
+
+        return lhs_energy < rhs_energy || (lhs_energy == rhs_energy && lhs.charges < rhs.charges);
+    }
+    /**
+     * Retains the given compactly stored charge distribution if it is among the `k` lowest ones.
+     *
+     * @param e Compactly stored charge distribution.
+     */
+    void add(const entry& e)
+    {
+        if (heap.size() == capacity && !less(e, heap.front()))
+        {
+            return;
+        }
+
+        if (std::any_of(heap.cbegin(), heap.cend(), [&e](const auto& other) { return other.charges == e.charges; }))
+        {
+            return;
+        }
+
+        if (heap.size() == capacity)
+        {
+            std::pop_heap(heap.begin(), heap.end(), less);
+            heap.pop_back();
+        }
+
+        heap.push_back(e);
+        std::push_heap(heap.begin(), heap.end(), less);
+    }
+};
+/**
+ * Ground state statistics that SiDB simulations accumulate while they find physically valid charge distributions. In
+ * contrast to `energy_distribution` and `minimum_energy`, they do not require all charge distributions to be retained,
+ * which is crucial for layouts with many metastable charge distributions.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ */
+template <typename Lyt>
+struct sidb_energy_statistics
+{
+    /**
+     * Standard constructor.
+     *
+     * @param k Number of charge distributions with the lowest system energies to retain.
+     */
+    explicit sidb_energy_statistics(const uint64_t k = 1) noexcept : lowest_states{k} {}
+    /**
+     * Histogram of the system energies.
+     */
+    energy_histogram histogram{};
+    /**
+     * Minimum system energy.
+     */
+    running_minimum_energy minimum{};
+    /**
+     * Charge distributions with the lowest system energies.
+     */
+    lowest_energy_states<Lyt> lowest_states;
+    /**
+     * Accumulates the statistics of the given charge distribution.
+     *
+     * @param charge_lyt Charge distribution surface whose system energy is up to date.
+     */
+    void add(const charge_distribution_surface<Lyt>& charge_lyt)
+    {
+        const auto energy = charge_lyt.get_system_energy();
+
+        histogram.add(energy);
+        minimum.add(energy);
+        lowest_states.add(charge_lyt);
+    }
+    /**
+     * Merges the statistics of another accumulator, e.g., of another thread.
+     *
+     * @param other Accumulator to merge.
+     */
+    void merge(const sidb_energy_statistics<Lyt>& other)
+    {
+        histogram.merge(other.histogram);
+        minimum.merge(other.minimum);
+        lowest_states.merge(other.lowest_states);
+    }
+    /**
+     * Checks whether no charge distribution was accumulated.
+     *
+     * @return `true` iff no charge distribution was accumulated.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return histogram.empty();
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_ENERGY_STATISTICS_HPP
@@ -6,14 +6,23 @@
 #define FICTION_EXHAUSTIVE_GROUND_STATE_SIMULATION_HPP
 
 #include "fiction/algorithms/simulation/sidb/energy_distribution.hpp"
+#include "fiction/algorithms/simulation/sidb/energy_statistics.hpp"
 #include "fiction/algorithms/simulation/sidb/minimum_energy.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/charge_distribution_index.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
 
 #include <fmt/format.h>
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <thread>
 #include <vector>
 
 namespace fiction
@@ -24,77 +33,459 @@ struct exgs_stats
 {
     mockturtle::stopwatch<>::duration             time_total{0};
     std::vector<charge_distribution_surface<Lyt>> valid_lyts{};
+    /**
+     * Physically valid charge distributions that are stored compactly if `exgs_params::compact_results` is set.
+     */
+    compact_charge_distributions<Lyt> compact_valid_lyts{};
+    /**
+     * Statistics of all physically valid charge distributions that are accumulated during the simulation regardless of
+     * whether the charge distributions are retained (see `exgs_params::retain_valid_lyts`).
+     */
+    sidb_energy_statistics<Lyt> energy_statistics{};
 
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("total time  = {:.2f} secs\n", mockturtle::to_seconds(time_total));
-        if (!valid_lyts.empty())
+        if (!energy_statistics.empty())
         {
-            for (const auto& [energy, count] : energy_distribution<Lyt>(valid_lyts))
+            for (const auto& [energy, count] : energy_statistics.histogram.get_distribution())
             {
                 out << fmt::format("energy: {} | occurance: {} \n", energy, count);
             }
-            out << fmt::format("the ground state energy is  = {:.4f} \n", minimum_energy(valid_lyts));
+            out << fmt::format("the ground state energy is  = {:.4f} \n", energy_statistics.minimum.get_value());
         }
         else
         {
-            std::cout << "no state found | if two state simulation is used, continue with three state" << std::endl;
+            out << "no state found | if two state simulation is used, continue with three state" << std::endl;
         }
 
-        out << fmt::format("{} phyiscally valid charge states were found \n", valid_lyts.size());
-        std::cout << "_____________________________________________________ \n";
+        out << fmt::format("{} phyiscally valid charge states were found \n", energy_statistics.histogram.size());
+        out << "_____________________________________________________ \n";
     }
 };
 
 /**
- *  All metastable and physically valid charge distribution layouts are computed, stored in a vector and returned.
+ * Order in which the exhaustive ground state simulation enumerates the charge distributions of an SiDB layout.
+ */
+enum class exgs_enumeration
+{
+    /**
+     * The charge distribution index is increased by one in each step. Since several SiDBs can change their charge
+     * state at once, the charge distribution is rebuilt and all local potentials are recomputed in \f$ O(n^2) \f$.
+     */
+    LEXICOGRAPHIC,
+    /**
+     * The charge distributions are enumerated in the order of a reflected base-2 or base-3 Gray code such that exactly
+     * one SiDB changes its charge state by one in each step. Thereby, local potentials and the system energy can be
+     * updated incrementally in \f$ O(n) \f$.
+     */
+    GRAY_CODE
+};
+/**
+ * This struct stores the parameters for the exhaustive ground state simulation.
+ */
+struct exgs_params
+{
+    /**
+     * General parameters for the simulation of the physical SiDB system.
+     */
+    sidb_simulation_parameters phys_params{};
+    /**
+     * Order in which the charge distributions are enumerated.
+     */
+    exgs_enumeration enumeration{exgs_enumeration::GRAY_CODE};
+    /**
+     * Number of threads to spawn. The charge distribution index space is partitioned into contiguous ranges that are
+     * processed concurrently. By default the number of threads is set to the number of available hardware threads.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
+    /**
+     * If set, the physically valid charge distributions are stored compactly in `exgs_stats::compact_valid_lyts`
+     * instead of as full charge distribution surfaces in `exgs_stats::valid_lyts`. This reduces the memory consumption
+     * considerably if many metastable charge distributions exist.
+     */
+    bool compact_results{false};
+    /**
+     * If not set, the physically valid charge distributions are neither stored in `exgs_stats::valid_lyts` nor in
+     * `exgs_stats::compact_valid_lyts`. Only `exgs_stats::energy_statistics` is accumulated such that the memory
+     * consumption does not depend on the number of metastable charge distributions.
+     */
+    bool retain_valid_lyts{true};
+    /**
+     * Number of physically valid charge distributions with the lowest system energies that are retained in
+     * `exgs_stats::energy_statistics` in any case.
+     */
+    uint64_t num_lowest_energy_states{1};
+};
+
+namespace detail
+{
+
+/**
+ * Sorts the given charge distribution surfaces in ascending order of their charge index.
  *
  * @tparam Lyt Cell-level layout type.
- * @param lyt The layout to simulate.
- * @param params Simulation parameters.
- * @param ps Simulation statistics.
+ * @param charge_lyts The charge distribution surfaces to sort.
  */
 template <typename Lyt>
-void exhaustive_ground_state_simulation(const Lyt&                        lyt,
-                                        const sidb_simulation_parameters& params = sidb_simulation_parameters{},
-                                        exgs_stats<Lyt>*                  ps     = nullptr) noexcept
+void sort_by_charge_index(std::vector<charge_distribution_surface<Lyt>>& charge_lyts)
 {
-    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
-    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    std::sort(charge_lyts.begin(), charge_lyts.end(),
+              [](const auto& lhs, const auto& rhs)
+              { return lhs.get_charge_index().first < rhs.get_charge_index().first; });
+}
 
-    exgs_stats<Lyt> st{};
+template <typename Lyt>
+class exhaustive_ground_state_simulation_impl
+{
+  public:
+    exhaustive_ground_state_simulation_impl(const Lyt& lyt, const exgs_params& p, exgs_stats<Lyt>& st) :
+            initial_lyt{lyt, p.phys_params},
+            ps{p},
+            pst{st}
+    {}
+    /**
+     * Constructor for a charge distribution surface that already holds the charge-independent model of the layout to
+     * simulate, which may be shared with other simulations. Its physical parameters are used instead of
+     * `p.phys_params`.
+     *
+     * @param cds Charge distribution surface of the layout to simulate.
+     * @param p Parameters.
+     * @param st Statistics.
+     */
+    exhaustive_ground_state_simulation_impl(const charge_distribution_surface<Lyt>& cds, const exgs_params& p,
+                                            exgs_stats<Lyt>& st) :
+            initial_lyt{cds},
+            ps{p},
+            pst{st}
+    {}
 
+    void run()
     {
-        mockturtle::stopwatch stop{st.time_total};
+        mockturtle::stopwatch stop{pst.time_total};
 
-        charge_distribution_surface charge_lyt{lyt};
+        charge_distribution_surface<Lyt> charge_lyt{initial_lyt};
 
-        charge_lyt.set_physical_parameters(params);
         charge_lyt.set_all_charge_states(sidb_charge_state::NEGATIVE);
         charge_lyt.update_after_charge_change();
 
-        while (charge_lyt.get_charge_index().first < charge_lyt.get_max_charge_index())
+        if (ps.compact_results)
         {
+            pst.compact_valid_lyts = compact_charge_distributions<Lyt>{
+                std::make_shared<const charge_distribution_surface<Lyt>>(charge_lyt)};
+        }
+
+        pst.energy_statistics = sidb_energy_statistics<Lyt>{ps.num_lowest_energy_states};
+
+        // If the number of threads is initially set to zero, the simulation is run with one thread.
+        const auto num_threads = std::max(ps.number_threads, uint64_t{1});
 
-            if (charge_lyt.is_physically_valid())
+        const auto num_sidbs = charge_lyt.num_cells();
+        const auto base      = static_cast<uint64_t>(charge_lyt.get_phys_params().base);
+
+        // fix the charge states of the first SiDBs to obtain enough ranges for a balanced workload
+        uint64_t prefix_length = 0;
+        uint64_t num_ranges    = 1;
+
+        if (num_threads > 1)
+        {
+            while (num_ranges < ranges_per_thread * num_threads && prefix_length < num_sidbs)
             {
-                st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+                ++prefix_length;
+                num_ranges *= base;
             }
+        }
 
-            charge_lyt.increase_charge_index_by_one();
+        if (num_ranges == 1)
+        {
+            enumerate_range(charge_lyt, 0, prefix_length, pst);
+        }
+        else
+        {
+            const auto num_workers = std::min(num_threads, num_ranges);
+
+            std::vector<exgs_stats<Lyt>> worker_results(num_workers);
+            std::atomic<uint64_t>        next_range{0};
+
+            for (auto& results : worker_results)
+            {
+                results.compact_valid_lyts = pst.compact_valid_lyts;
+                results.energy_statistics  = pst.energy_statistics;
+            }
+
+            std::vector<std::thread> threads{};
+            threads.reserve(num_workers);
+
+            for (uint64_t w = 0; w < num_workers; ++w)
+            {
+                threads.emplace_back(
+                    [&, w]
+                    {
+                        charge_distribution_surface<Lyt> worker_lyt{charge_lyt};
+
+                        while (true)
+                        {
+                            const auto r = next_range.fetch_add(1, std::memory_order_relaxed);
+
+                            if (r >= num_ranges)
+                            {
+                                break;
+                            }
+
+                            enumerate_range(worker_lyt, r, prefix_length, worker_results[w]);
+                        }
+                    });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (auto& results : worker_results)
+            {
+                std::move(results.valid_lyts.begin(), results.valid_lyts.end(), std::back_inserter(pst.valid_lyts));
+                pst.compact_valid_lyts.append(results.compact_valid_lyts);
+                pst.energy_statistics.merge(results.energy_statistics);
+            }
         }
 
+        sort_by_charge_index(pst.valid_lyts);
+        pst.compact_valid_lyts.sort_by_charge_index();
+    }
+
+  private:
+    /**
+     * Charge distribution surface of the layout to simulate.
+     */
+    const charge_distribution_surface<Lyt> initial_lyt;
+    /**
+     * Parameters.
+     */
+    const exgs_params ps;
+    /**
+     * Statistics.
+     */
+    exgs_stats<Lyt>& pst;
+    /**
+     * Number of charge distribution index ranges that are created per thread such that threads that finish early can
+     * pick up the remaining work.
+     */
+    static constexpr const uint64_t ranges_per_thread = 8;
+
+    /**
+     * Accumulates the statistics of the given charge distribution surface and stores it, either as a copy or
+     * compactly, if it is physically valid. Since not all enumeration orders keep the charge distribution index up to
+     * date, it is recomputed beforehand.
+     *
+     * @param charge_lyt The charge distribution surface to store.
+     * @param results The statistics to store the physically valid charge distribution in.
+     */
+    void store_if_physically_valid(const charge_distribution_surface<Lyt>& charge_lyt, exgs_stats<Lyt>& results) const
+    {
         if (charge_lyt.is_physically_valid())
         {
-            st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+            results.energy_statistics.add(charge_lyt);
+
+            if (!ps.retain_valid_lyts)
+            {
+                return;
+            }
+
+            charge_lyt.charge_distribution_to_index();
+
+            if (ps.compact_results)
+            {
+                results.compact_valid_lyts.add(charge_lyt);
+            }
+            else
+            {
+                results.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+            }
+        }
+    }
+    /**
+     * Enumerates a contiguous range of charge distribution indices. The range is defined by fixing the charge states
+     * of the first `prefix_length` SiDBs, i.e., the most significant digits of the charge distribution index, to the
+     * digits of `range` while the charge states of all remaining SiDBs are enumerated.
+     *
+     * @param charge_lyt Charge distribution surface to use for the enumeration. Its charge states are overwritten.
+     * @param range Index of the range, i.e., the value of the fixed most significant digits.
+     * @param prefix_length Number of SiDBs whose charge states are fixed.
+     * @param results The statistics to store the physically valid charge distributions in.
+     */
+    void enumerate_range(charge_distribution_surface<Lyt>& charge_lyt, const uint64_t range,
+                         const uint64_t prefix_length, exgs_stats<Lyt>& results) const
+    {
+        const auto base = static_cast<uint64_t>(charge_lyt.get_phys_params().base);
+
+        charge_lyt.set_all_charge_states(sidb_charge_state::NEGATIVE);
+
+        switch (ps.enumeration)
+        {
+            case exgs_enumeration::LEXICOGRAPHIC:
+            {
+                // the range consists of all indices whose most significant digits equal `range`; the indices are
+                // computed exactly since they exceed 64 bits for large layouts
+                charge_distribution_index first_index{range};
+                charge_distribution_index last_index{range + 1};
+
+                for (auto i = prefix_length; i < charge_lyt.num_cells(); ++i)
+                {
+                    first_index *= static_cast<uint32_t>(base);
+                    last_index *= static_cast<uint32_t>(base);
+                }
+
+                last_index -= 1;
+
+                charge_lyt.assign_charge_index(first_index);
+                charge_lyt.update_after_charge_change();
+
+                enumerate_lexicographically(charge_lyt, last_index, results);
+
+                break;
+            }
+            case exgs_enumeration::GRAY_CODE:
+            {
+                for (uint64_t i = prefix_length, r = range; i-- > 0; r /= base)
+                {
+                    charge_lyt.assign_charge_state_by_cell_index(
+                        i, sign_to_charge_state(static_cast<int8_t>(static_cast<int8_t>(r % base) - 1)), false);
+                }
+                charge_lyt.update_after_charge_change();
+
+                enumerate_gray_code(charge_lyt, prefix_length, results);
+
+                break;
+            }
+        }
+    }
+    /**
+     * Enumerates all charge distributions from the current one up to the given charge distribution index by increasing
+     * the charge distribution index one by one.
+     *
+     * @param charge_lyt Charge distribution surface whose charge distribution index is the first one to enumerate.
+     * @param last_index Last charge distribution index to enumerate.
+     * @param results The statistics to store the physically valid charge distributions in.
+     */
+    void enumerate_lexicographically(charge_distribution_surface<Lyt>& charge_lyt,
+                                     const charge_distribution_index& last_index, exgs_stats<Lyt>& results) const
+    {
+        while (charge_lyt.get_charge_index().first < last_index)
+        {
+            store_if_physically_valid(charge_lyt, results);
+
+            charge_lyt.increase_charge_index_by_one();
+        }
+
+        store_if_physically_valid(charge_lyt, results);
+    }
+    /**
+     * Enumerates all charge distributions of the SiDBs starting at `first_sidb` in the order of a reflected Gray code
+     * in the simulation base while the charge states of all preceding SiDBs remain unchanged. The last SiDB
+     * represents the least significant digit. In each step, the least significant digit that can still be moved in its
+     * current direction is increased or decreased by one and the directions of all less significant digits are
+     * reversed. Thereby, exactly one SiDB changes its charge state in each step, and since a digit of `0` represents a
+     * negative charge, the enumeration starts at the same charge distribution as the lexicographic one.
+     *
+     * @param charge_lyt Charge distribution surface whose SiDBs starting at `first_sidb` are all negatively charged.
+     * @param first_sidb Index of the first SiDB whose charge state is enumerated.
+     * @param results The statistics to store the physically valid charge distributions in.
+     */
+    void enumerate_gray_code(charge_distribution_surface<Lyt>& charge_lyt, const uint64_t first_sidb,
+                             exgs_stats<Lyt>& results) const
+    {
+        const auto num_sidbs = charge_lyt.num_cells();
+        const auto base      = static_cast<int8_t>(charge_lyt.get_phys_params().base);
+
+        std::vector<int8_t> digits(num_sidbs, 0);
+        std::vector<int8_t> directions(num_sidbs, 1);
+
+        store_if_physically_valid(charge_lyt, results);
+
+        while (true)
+        {
+            auto moved = false;
+
+            for (auto i = num_sidbs; i-- > first_sidb;)
+            {
+                if (const auto next = static_cast<int8_t>(digits[i] + directions[i]); next >= 0 && next < base)
+                {
+                    digits[i] = next;
+                    charge_lyt.assign_charge_state_by_cell_index(i, sign_to_charge_state(static_cast<int8_t>(next - 1)),
+                                                                 false);
+                    moved = true;
+
+                    break;
+                }
+
+                directions[i] = static_cast<int8_t>(-directions[i]);
+            }
+
+            if (!moved)
+            {
+                break;
+            }
+
+            charge_lyt.update_after_charge_change();
+
+            store_if_physically_valid(charge_lyt, results);
         }
     }
+};
+
+}  // namespace detail
+
+/**
+ * All metastable and physically valid charge distribution layouts are computed, stored in a vector and returned. By
+ * default, the charge distributions are enumerated in the order of a reflected Gray code such that each step requires
+ * only an incremental \f$ O(n) \f$ update of the local potentials and the system energy. The charge distribution index
+ * space is split into contiguous ranges that are simulated in parallel by `ps.number_threads` threads. Regardless of
+ * the enumeration order and the number of threads, the physically valid charge distribution layouts are reported in
+ * ascending order of their charge index.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Parameters.
+ * @param pst Simulation statistics.
+ */
+template <typename Lyt>
+void exhaustive_ground_state_simulation(const Lyt& lyt, const exgs_params& ps, exgs_stats<Lyt>* pst = nullptr) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    exgs_stats<Lyt> st{};
+
+    detail::exhaustive_ground_state_simulation_impl<Lyt> p{lyt, ps, st};
 
-    if (ps)
+    p.run();
+
+    if (pst)
     {
-        *ps = st;
+        *pst = st;
     }
 }
+/**
+ *  All metastable and physically valid charge distribution layouts are computed, stored in a vector and returned.
+ *
+ *  This overload runs on a single thread. To simulate in parallel, use the overload that takes `exgs_params`.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param params Simulation parameters.
+ * @param ps Simulation statistics.
+ */
+template <typename Lyt>
+void exhaustive_ground_state_simulation(const Lyt&                        lyt,
+                                        const sidb_simulation_parameters& params = sidb_simulation_parameters{},
+                                        exgs_stats<Lyt>*                  ps     = nullptr) noexcept
+{
+    exgs_params exgs_ps{params};
+    exgs_ps.number_threads = 1;
+
+    exhaustive_ground_state_simulation(lyt, exgs_ps, ps);
+}
 
 }  // namespace fiction
 
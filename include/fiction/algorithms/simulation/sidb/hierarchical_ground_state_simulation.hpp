@@ -0,0 +1,774 @@
+#ifndef FICTION_HIERARCHICAL_GROUND_STATE_SIMULATION_HPP
+#define FICTION_HIERARCHICAL_GROUND_STATE_SIMULATION_HPP
+
+#include "fiction/algorithms/simulation/sidb/energy_statistics.hpp"
+#include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/quicksim.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/physical_constants.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/traits.hpp"
+
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * This struct stores the parameters for the hierarchical ground state simulation.
+ */
+struct hierarchical_simulation_params
+{
+    /**
+     * General parameters for the simulation of the physical SiDB system.
+     */
+    sidb_simulation_parameters phys_params{};
+    /**
+     * SiDBs that are closer to each other than this distance (unit: m) belong to the same cluster. All charge
+     * distributions of each cluster are enumerated; hence, the distance should be chosen such that clusters stay small,
+     * e.g., such that each BDL pair forms a cluster of its own.
+     */
+    double cluster_distance{1.0 * 1E-9};
+    /**
+     * Maximum number of SiDBs per cluster. Since the number of charge distributions of a cluster grows exponentially
+     * with its size, larger clusters are split into clusters of at most this many SiDBs, which keeps the simulation
+     * exact but weakens the pruning. The limit is capped at the largest cluster size whose charge distributions can be
+     * indexed with 64 bits, e.g., 40 SiDBs for three charge states.
+     */
+    uint64_t max_cluster_size{12};
+    /**
+     * Maximum number of sweeps over all clusters of the heuristic combination.
+     */
+    uint64_t max_iterations{100};
+    /**
+     * Number of lowest-energy charge distributions that are retained in the energy statistics.
+     */
+    uint64_t num_lowest_energy_states{1};
+};
+
+namespace detail
+{
+
+template <typename Lyt>
+class hierarchical_ground_state_simulation_impl
+{
+  public:
+    hierarchical_ground_state_simulation_impl(const Lyt& lyt, const hierarchical_simulation_params& p) :
+            charge_lyt{lyt, p.phys_params, sidb_charge_state::NEGATIVE},
+            ps{p},
+            num_sidbs{charge_lyt.num_cells()},
+            max_sign{static_cast<int8_t>(ps.phys_params.base == 3 ? 1 : 0)}
+    {}
+    /**
+     * Determines all physically valid charge distributions by combining the charge distributions of all clusters
+     * exactly. Only combinations that may be population-stable according to the inter-cluster potential bounds are
+     * considered.
+     *
+     * @tparam Stats Statistics type, i.e., `exgs_stats<Lyt>` or `quicksim_stats<Lyt>`.
+     * @param st Statistics to store the physically valid charge distributions in.
+     */
+    template <typename Stats>
+    void run_exact(Stats& st)
+    {
+        mockturtle::stopwatch stop{st.time_total};
+
+        st.energy_statistics = sidb_energy_statistics<Lyt>{ps.num_lowest_energy_states};
+
+        if (!prepare())
+        {
+            return;
+        }
+
+        std::vector<double> fixed_pot(num_sidbs, 0.0);
+        std::vector<double> lower_rem(num_sidbs);
+        std::vector<double> upper_rem(num_sidbs);
+
+        // the potential bounds of all other clusters apply as long as no cluster is fixed
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            lower_rem[i] = total_lower[i] - lower_bounds[cluster_of[i]][i];
+            upper_rem[i] = total_upper[i] - upper_bounds[cluster_of[i]][i];
+        }
+
+        std::vector<uint64_t> chosen(clusters.size(), 0);
+
+        combine_exactly(0, fixed_pot, lower_rem, upper_rem, chosen, st);
+
+        sort_by_charge_index(st.valid_lyts);
+    }
+    /**
+     * Determines a charge distribution by combining the charge distributions of all clusters heuristically. Starting
+     * from the lowest-energy charge distribution of each cluster, the charge distribution of one cluster at a time is
+     * replaced by its best one in the presence of all others until no cluster changes anymore.
+     *
+     * @param st Statistics to store the charge distribution in if it is physically valid.
+     */
+    void run_heuristic(quicksim_stats<Lyt>& st)
+    {
+        mockturtle::stopwatch stop{st.time_total};
+
+        st.energy_statistics = sidb_energy_statistics<Lyt>{ps.num_lowest_energy_states};
+
+        if (!prepare())
+        {
+            return;
+        }
+
+        std::vector<uint64_t> chosen(clusters.size(), 0);
+
+        for (uint64_t k = 0; k < clusters.size(); ++k)
+        {
+            chosen[k] = static_cast<uint64_t>(
+                std::distance(configurations[k].cbegin(),
+                              std::min_element(configurations[k].cbegin(), configurations[k].cend(),
+                                               [](const auto& lhs, const auto& rhs)
+                                               { return lhs.internal_energy < rhs.internal_energy; })));
+        }
+
+        // potential at each SiDB caused by all clusters except for its own
+        std::vector<double> other_pot(num_sidbs, 0.0);
+
+        for (uint64_t k = 0; k < clusters.size(); ++k)
+        {
+            add_cluster_potential(k, configurations[k][chosen[k]], 1.0, other_pot);
+        }
+
+        uint64_t iteration = 0;
+
+        for (bool changed = true; changed && iteration < ps.max_iterations; ++iteration)
+        {
+            changed = false;
+
+            for (uint64_t k = 0; k < clusters.size(); ++k)
+            {
+                const auto best = best_configuration(k, other_pot);
+
+                if (best != chosen[k])
+                {
+                    add_cluster_potential(k, configurations[k][chosen[k]], -1.0, other_pot);
+                    add_cluster_potential(k, configurations[k][best], 1.0, other_pot);
+
+                    chosen[k] = best;
+                    changed   = true;
+                }
+            }
+        }
+
+        st.completed_iterations = iteration;
+
+        record_if_valid(chosen, st);
+    }
+
+  private:
+    /**
+     * A charge distribution of a single cluster.
+     */
+    struct cluster_configuration
+    {
+        /**
+         * Charge signs of the cluster's SiDBs.
+         */
+        std::vector<int8_t> signs{};
+        /**
+         * Local potential at each of the cluster's SiDBs that is caused by the cluster itself and external charges.
+         */
+        std::vector<double> internal_potential{};
+        /**
+         * Electrostatic energy of the cluster in the presence of external charges.
+         */
+        double internal_energy{};
+    };
+    /**
+     * Charge distribution surface of the layout to simulate.
+     */
+    charge_distribution_surface<Lyt> charge_lyt;
+    /**
+     * Parameters.
+     */
+    const hierarchical_simulation_params ps;
+    /**
+     * Number of SiDBs.
+     */
+    const uint64_t num_sidbs;
+    /**
+     * Largest charge sign, i.e., `1` for three and `0` for two charge states.
+     */
+    const int8_t max_sign;
+    /**
+     * Indices of the SiDBs of each cluster.
+     */
+    std::vector<std::vector<uint64_t>> clusters{};
+    /**
+     * Cluster of each SiDB.
+     */
+    std::vector<uint64_t> cluster_of{};
+    /**
+     * Charge distributions of each cluster that may be part of a population-stable charge distribution.
+     */
+    std::vector<std::vector<cluster_configuration>> configurations{};
+    /**
+     * `lower_bounds[d][i]` and `upper_bounds[d][i]` bound the potential that cluster `d` causes at SiDB `i`.
+     */
+    std::vector<std::vector<double>> lower_bounds{}, upper_bounds{};
+    /**
+     * Sum of the bounds of all clusters at each SiDB.
+     */
+    std::vector<double> total_lower{}, total_upper{};
+    /**
+     * Tolerance for the rounding errors of the potential bounds, which keeps the pruning conservative.
+     */
+    static constexpr const double BOUND_TOLERANCE = 1E-9;
+
+    /**
+     * Partitions the SiDBs into clusters, enumerates the charge distributions of each cluster, and prunes them with the
+     * inter-cluster potential bounds until a fixed point is reached.
+     *
+     * @return `false` iff no population-stable charge distribution exists.
+     */
+    bool prepare()
+    {
+        if (num_sidbs == 0)
+        {
+            return false;
+        }
+
+        partition_into_clusters();
+
+        // initially, each SiDB may be in any charge state
+        std::vector<int8_t> min_signs(num_sidbs, -1);
+        std::vector<int8_t> max_signs(num_sidbs, max_sign);
+
+        compute_bounds(min_signs, max_signs);
+
+        configurations.resize(clusters.size());
+
+        for (uint64_t k = 0; k < clusters.size(); ++k)
+        {
+            enumerate_cluster(k);
+        }
+
+        for (bool changed = true; changed;)
+        {
+            if (std::any_of(configurations.cbegin(), configurations.cend(),
+                            [](const auto& configs) { return configs.empty(); }))
+            {
+                return false;
+            }
+
+            // the charge states that remain possible for each SiDB determine the tightened bounds
+            for (uint64_t k = 0; k < clusters.size(); ++k)
+            {
+                for (uint64_t l = 0; l < clusters[k].size(); ++l)
+                {
+                    const auto [min_it, max_it] = std::minmax_element(
+                        configurations[k].cbegin(), configurations[k].cend(),
+                        [l](const auto& lhs, const auto& rhs) { return lhs.signs[l] < rhs.signs[l]; });
+
+                    min_signs[clusters[k][l]] = min_it->signs[l];
+                    max_signs[clusters[k][l]] = max_it->signs[l];
+                }
+            }
+
+            compute_bounds(min_signs, max_signs);
+
+            changed = false;
+
+            for (uint64_t k = 0; k < clusters.size(); ++k)
+            {
+                const auto num_configs = configurations[k].size();
+
+                configurations[k].erase(std::remove_if(configurations[k].begin(), configurations[k].end(),
+                                                       [this, k](const auto& config)
+                                                       { return !may_be_population_stable(k, config); }),
+                                        configurations[k].end());
+
+                changed = changed || configurations[k].size() != num_configs;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Partitions the SiDBs into clusters such that SiDBs closer than `cluster_distance` belong to the same cluster.
+     */
+    void partition_into_clusters()
+    {
+        std::vector<uint64_t> parent(num_sidbs);
+        std::iota(parent.begin(), parent.end(), uint64_t{0});
+
+        const auto find = [&parent](uint64_t i)
+        {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i         = parent[i];
+            }
+
+            return i;
+        };
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            for (uint64_t j = i + 1; j < num_sidbs; ++j)
+            {
+                if (charge_lyt.get_distance_by_indices(i, j) < ps.cluster_distance)
+                {
+                    parent[find(j)] = find(i);
+                }
+            }
+        }
+
+        cluster_of.assign(num_sidbs, std::numeric_limits<uint64_t>::max());
+        std::vector<uint64_t> cluster_of_root(num_sidbs, std::numeric_limits<uint64_t>::max());
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            const auto root = find(i);
+
+            if (cluster_of_root[root] == std::numeric_limits<uint64_t>::max())
+            {
+                cluster_of_root[root] = clusters.size();
+                clusters.emplace_back();
+            }
+
+            cluster_of[i] = cluster_of_root[root];
+            clusters[cluster_of[i]].push_back(i);
+        }
+
+        split_large_clusters();
+    }
+    /**
+     * Splits each cluster that exceeds the maximum cluster size into clusters of consecutive SiDBs.
+     */
+    void split_large_clusters()
+    {
+        const auto max_size = std::clamp(ps.max_cluster_size, uint64_t{1}, max_representable_cluster_size());
+
+        for (uint64_t k = 0; k < clusters.size(); ++k)
+        {
+            if (clusters[k].size() <= max_size)
+            {
+                continue;
+            }
+
+            // the SiDBs beyond the first chunk form a new cluster that is split in turn
+            std::vector<uint64_t> rest(clusters[k].cbegin() + static_cast<std::ptrdiff_t>(max_size),
+                                       clusters[k].cend());
+            clusters[k].resize(max_size);
+
+            for (const auto i : rest)
+            {
+                cluster_of[i] = clusters.size();
+            }
+
+            clusters.push_back(std::move(rest));
+        }
+    }
+    /**
+     * Determines the largest number of SiDBs whose charge distributions can be indexed with 64 bits.
+     *
+     * @return Largest cluster size that can be enumerated.
+     */
+    [[nodiscard]] uint64_t max_representable_cluster_size() const noexcept
+    {
+        const auto base = static_cast<uint64_t>(ps.phys_params.base);
+
+        uint64_t size = 0;
+
+        for (uint64_t num_configs = 1; num_configs <= std::numeric_limits<uint64_t>::max() / base; num_configs *= base)
+        {
+            ++size;
+        }
+
+        return size;
+    }
+    /**
+     * Computes the bounds of the potential that each cluster causes at each SiDB given the possible charge states of
+     * the cluster's SiDBs. Since all potentials between SiDBs are positive, the bounds are attained by the smallest and
+     * largest charge signs.
+     *
+     * @param min_signs Smallest possible charge sign of each SiDB.
+     * @param max_signs Largest possible charge sign of each SiDB.
+     */
+    void compute_bounds(const std::vector<int8_t>& min_signs, const std::vector<int8_t>& max_signs)
+    {
+        lower_bounds.assign(clusters.size(), std::vector<double>(num_sidbs, 0.0));
+        upper_bounds.assign(clusters.size(), std::vector<double>(num_sidbs, 0.0));
+        total_lower.assign(num_sidbs, 0.0);
+        total_upper.assign(num_sidbs, 0.0);
+
+        for (uint64_t d = 0; d < clusters.size(); ++d)
+        {
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                if (cluster_of[i] == d)
+                {
+                    continue;
+                }
+
+                for (const auto j : clusters[d])
+                {
+                    const auto pot = charge_lyt.get_electrostatic_potential_by_indices(i, j);
+
+                    lower_bounds[d][i] += pot * min_signs[j];
+                    upper_bounds[d][i] += pot * max_signs[j];
+                }
+
+                total_lower[i] += lower_bounds[d][i];
+                total_upper[i] += upper_bounds[d][i];
+            }
+        }
+    }
+    /**
+     * Enumerates all charge distributions of the given cluster and retains the ones that may be population-stable.
+     *
+     * @param k Index of the cluster.
+     */
+    void enumerate_cluster(const uint64_t k)
+    {
+        const auto& cluster = clusters[k];
+        const auto  base    = static_cast<uint64_t>(ps.phys_params.base);
+
+        uint64_t num_configs = 1;
+        for (uint64_t l = 0; l < cluster.size(); ++l)
+        {
+            num_configs *= base;
+        }
+
+        for (uint64_t index = 0; index < num_configs; ++index)
+        {
+            cluster_configuration config{std::vector<int8_t>(cluster.size()),
+                                         std::vector<double>(cluster.size(), 0.0), 0.0};
+
+            for (uint64_t l = 0, rest = index; l < cluster.size(); ++l, rest /= base)
+            {
+                config.signs[l] = static_cast<int8_t>(static_cast<int8_t>(rest % base) - 1);
+            }
+
+            for (uint64_t l = 0; l < cluster.size(); ++l)
+            {
+                config.internal_potential[l] = charge_lyt.get_external_potential_by_index(cluster[l]);
+
+                for (uint64_t m = 0; m < cluster.size(); ++m)
+                {
+                    if (m != l)
+                    {
+                        config.internal_potential[l] +=
+                            charge_lyt.get_electrostatic_potential_by_indices(cluster[l], cluster[m]) * config.signs[m];
+                    }
+                }
+
+                // the mutual energy of two SiDBs of the cluster is counted half at each of them
+                config.internal_energy +=
+                    0.5 * (config.internal_potential[l] + charge_lyt.get_external_potential_by_index(cluster[l])) *
+                    config.signs[l];
+            }
+
+            if (may_be_population_stable(k, config))
+            {
+                configurations[k].push_back(std::move(config));
+            }
+        }
+    }
+    /**
+     * Checks whether an SiDB in the given charge state is population-stable for some local potential within the given
+     * interval.
+     *
+     * @param sign Charge sign of the SiDB.
+     * @param lower Lower bound of the local potential.
+     * @param upper Upper bound of the local potential.
+     * @return `true` iff the charge state may be population-stable.
+     */
+    [[nodiscard]] bool is_stable_within(const int8_t sign, const double lower, const double upper) const noexcept
+    {
+        const auto err = physical_constants::POP_STABILITY_ERR + BOUND_TOLERANCE;
+
+        switch (sign)
+        {
+            case -1: return upper > ps.phys_params.mu - err;
+            case 0: return upper > ps.phys_params.mu_p - err && lower < ps.phys_params.mu + err;
+            default: return lower < ps.phys_params.mu_p + err;
+        }
+    }
+    /**
+     * Checks whether the given charge distribution of a cluster may be population-stable given the bounds of the
+     * potentials caused by all other clusters.
+     *
+     * @param k Index of the cluster.
+     * @param config Charge distribution of the cluster.
+     * @return `true` iff all SiDBs of the cluster may be population-stable.
+     */
+    [[nodiscard]] bool may_be_population_stable(const uint64_t k, const cluster_configuration& config) const noexcept
+    {
+        for (uint64_t l = 0; l < clusters[k].size(); ++l)
+        {
+            const auto i = clusters[k][l];
+
+            if (!is_stable_within(config.signs[l], config.internal_potential[l] + total_lower[i] - lower_bounds[k][i],
+                                  config.internal_potential[l] + total_upper[i] - upper_bounds[k][i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Adds the scaled potential that the given charge distribution of a cluster causes at all SiDBs of other clusters.
+     *
+     * @param k Index of the cluster.
+     * @param config Charge distribution of the cluster.
+     * @param factor Scaling factor, e.g., `-1` to remove the potential.
+     * @param pot Potentials to add to.
+     */
+    void add_cluster_potential(const uint64_t k, const cluster_configuration& config, const double factor,
+                               std::vector<double>& pot) const noexcept
+    {
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            if (cluster_of[i] == k)
+            {
+                continue;
+            }
+
+            for (uint64_t l = 0; l < clusters[k].size(); ++l)
+            {
+                pot[i] += factor * charge_lyt.get_electrostatic_potential_by_indices(i, clusters[k][l]) *
+                          config.signs[l];
+            }
+        }
+    }
+    /**
+     * Fixes the charge distributions of the clusters one after another and prunes partial combinations whose fixed
+     * SiDBs cannot be population-stable anymore.
+     *
+     * @tparam Stats Statistics type.
+     * @param k Index of the cluster to fix next.
+     * @param fixed_pot Potential at each SiDB caused by the fixed clusters except for its own.
+     * @param lower_rem Lower bound of the potential at each SiDB caused by the clusters that are not fixed yet.
+     * @param upper_rem Upper bound of the potential at each SiDB caused by the clusters that are not fixed yet.
+     * @param chosen Indices of the charge distributions of the fixed clusters.
+     * @param st Statistics to store the physically valid charge distributions in.
+     */
+    template <typename Stats>
+    void combine_exactly(const uint64_t k, const std::vector<double>& fixed_pot, const std::vector<double>& lower_rem,
+                         const std::vector<double>& upper_rem, std::vector<uint64_t>& chosen, Stats& st)
+    {
+        if (k == clusters.size())
+        {
+            record_if_valid(chosen, st);
+
+            return;
+        }
+
+        for (uint64_t c = 0; c < configurations[k].size(); ++c)
+        {
+            auto next_fixed = fixed_pot;
+            auto next_lower = lower_rem;
+            auto next_upper = upper_rem;
+
+            add_cluster_potential(k, configurations[k][c], 1.0, next_fixed);
+
+            for (uint64_t i = 0; i < num_sidbs; ++i)
+            {
+                if (cluster_of[i] != k)
+                {
+                    next_lower[i] -= lower_bounds[k][i];
+                    next_upper[i] -= upper_bounds[k][i];
+                }
+            }
+
+            chosen[k] = c;
+
+            if (fixed_clusters_may_be_stable(k, next_fixed, next_lower, next_upper, chosen))
+            {
+                combine_exactly(k + 1, next_fixed, next_lower, next_upper, chosen, st);
+            }
+        }
+    }
+    /**
+     * Checks whether all SiDBs of the clusters `0` to `k` may be population-stable.
+     *
+     * @param k Index of the last fixed cluster.
+     * @param fixed_pot Potential at each SiDB caused by the fixed clusters except for its own.
+     * @param lower_rem Lower bound of the potential at each SiDB caused by the clusters that are not fixed yet.
+     * @param upper_rem Upper bound of the potential at each SiDB caused by the clusters that are not fixed yet.
+     * @param chosen Indices of the charge distributions of the fixed clusters.
+     * @return `true` iff no fixed SiDB is population-unstable for sure.
+     */
+    [[nodiscard]] bool fixed_clusters_may_be_stable(const uint64_t k, const std::vector<double>& fixed_pot,
+                                                    const std::vector<double>&   lower_rem,
+                                                    const std::vector<double>&   upper_rem,
+                                                    const std::vector<uint64_t>& chosen) const noexcept
+    {
+        for (uint64_t d = 0; d <= k; ++d)
+        {
+            const auto& config = configurations[d][chosen[d]];
+
+            for (uint64_t l = 0; l < clusters[d].size(); ++l)
+            {
+                const auto i   = clusters[d][l];
+                const auto pot = config.internal_potential[l] + fixed_pot[i];
+
+                if (!is_stable_within(config.signs[l], pot + lower_rem[i], pot + upper_rem[i]))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+    /**
+     * Determines the charge distribution of a cluster that has the lowest energy in the presence of all other
+     * clusters. Population-stable charge distributions are preferred.
+     *
+     * @param k Index of the cluster.
+     * @param other_pot Potential at each SiDB caused by all clusters except for its own.
+     * @return Index of the best charge distribution of the cluster.
+     */
+    [[nodiscard]] uint64_t best_configuration(const uint64_t k, const std::vector<double>& other_pot) const noexcept
+    {
+        uint64_t best        = 0;
+        bool     best_stable = false;
+        double   best_energy = std::numeric_limits<double>::max();
+
+        for (uint64_t c = 0; c < configurations[k].size(); ++c)
+        {
+            const auto& config = configurations[k][c];
+
+            auto energy = config.internal_energy;
+            auto stable = true;
+
+            for (uint64_t l = 0; l < clusters[k].size(); ++l)
+            {
+                const auto pot = config.internal_potential[l] + other_pot[clusters[k][l]];
+
+                energy += other_pot[clusters[k][l]] * config.signs[l];
+                stable = stable && is_stable_within(config.signs[l], pot, pot);
+            }
+
+            if ((stable && !best_stable) || (stable == best_stable && energy < best_energy))
+            {
+                best        = c;
+                best_stable = stable;
+                best_energy = energy;
+            }
+        }
+
+        return best;
+    }
+    /**
+     * Assigns the given charge distributions of all clusters to the layout and stores it if it is physically valid.
+     *
+     * @tparam Stats Statistics type.
+     * @param chosen Index of the charge distribution of each cluster.
+     * @param st Statistics to store the physically valid charge distribution in.
+     */
+    template <typename Stats>
+    void record_if_valid(const std::vector<uint64_t>& chosen, Stats& st)
+    {
+        for (uint64_t k = 0; k < clusters.size(); ++k)
+        {
+            for (uint64_t l = 0; l < clusters[k].size(); ++l)
+            {
+                charge_lyt.assign_charge_state_by_cell_index(
+                    clusters[k][l], sign_to_charge_state(configurations[k][chosen[k]].signs[l]), false);
+            }
+        }
+
+        charge_lyt.charge_distribution_to_index();
+        charge_lyt.update_after_charge_change();
+
+        if (charge_lyt.is_physically_valid())
+        {
+            st.energy_statistics.add(charge_lyt);
+            st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A hierarchical exact ground state simulation for layouts of many SiDBs that form spatially separated clusters,
+ * e.g., the BDL pairs of an SiDB circuit. The SiDBs are partitioned into clusters by their distances (see
+ * `hierarchical_simulation_params::cluster_distance`) and all charge distributions of each cluster are enumerated.
+ * Since the potential that a cluster causes at any other SiDB is bounded by the charge states its SiDBs may assume,
+ * charge distributions of a cluster that cannot be population-stable are discarded, which in turn tightens the bounds
+ * of all other clusters until a fixed point is reached. The remaining charge distributions of all clusters are then
+ * combined exactly, while partial combinations are pruned by the same bounds.
+ *
+ * All physically valid charge distributions are determined, i.e., the results equal the ones of
+ * `exhaustive_ground_state_simulation`, but the runtime depends on the number of charge distributions that survive
+ * the pruning instead of the total number of SiDBs.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Parameters.
+ * @param pst Statistics. They store all physically valid charge distributions.
+ */
+template <typename Lyt>
+void hierarchical_ground_state_simulation(const Lyt& lyt, const hierarchical_simulation_params& ps = {},
+                                          exgs_stats<Lyt>* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    exgs_stats<Lyt> st{};
+
+    detail::hierarchical_ground_state_simulation_impl<Lyt> p{lyt, ps};
+
+    p.run_exact(st);
+
+    if (pst)
+    {
+        *pst = st;
+    }
+}
+/**
+ * A hierarchical heuristic ground state simulation for layouts of many SiDBs that form spatially separated clusters.
+ * As for `hierarchical_ground_state_simulation`, the SiDBs are partitioned into clusters whose charge distributions
+ * are enumerated and pruned by inter-cluster potential bounds. Instead of combining them exactly, each cluster starts
+ * in its lowest-energy charge distribution and, one cluster at a time, is assigned the charge distribution with the
+ * lowest energy in the presence of all other clusters until no cluster changes anymore. The resulting charge
+ * distribution is stored if it is physically valid, such that the results can be compared to the ones of *QuickSim*.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Parameters.
+ * @param pst Statistics. They store the charge distribution that was found if it is physically valid.
+ */
+template <typename Lyt>
+void hierarchical_heuristic_simulation(const Lyt& lyt, const hierarchical_simulation_params& ps = {},
+                                       quicksim_stats<Lyt>* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    quicksim_stats<Lyt> st{};
+
+    detail::hierarchical_ground_state_simulation_impl<Lyt> p{lyt, ps};
+
+    p.run_heuristic(st);
+
+    if (pst)
+    {
+        *pst = st;
+    }
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_HIERARCHICAL_GROUND_STATE_SIMULATION_HPP
@@ -0,0 +1,516 @@
+#ifndef FICTION_INPUT_PATTERN_SIMULATION_HPP
+#define FICTION_INPUT_PATTERN_SIMULATION_HPP
+
+#include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/quicksim.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/physical_constants.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_surface.hpp"
+#include "fiction/traits.hpp"
+
+#include <fmt/format.h>
+#include <kitty/bit_operations.hpp>
+#include <kitty/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * The SiDBs that represent one input of an SiDB gate. Depending on the input value, one of two sets of SiDBs, e.g.,
+ * perturbers at different distances to the gate's input wire, is added to the gate's base layout.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ */
+template <typename Lyt>
+struct sidb_input_overlay
+{
+    /**
+     * SiDBs that are added to the base layout if the input is `0`.
+     */
+    std::vector<typename Lyt::cell> sidbs_if_false{};
+    /**
+     * SiDBs that are added to the base layout if the input is `1`.
+     */
+    std::vector<typename Lyt::cell> sidbs_if_true{};
+};
+/**
+ * A binary-dot logic (BDL) pair that represents one output of an SiDB gate. It encodes a `1` if only its lower SiDB is
+ * negatively charged and a `0` if only its upper SiDB is negatively charged.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ */
+template <typename Lyt>
+struct sidb_bdl_pair
+{
+    /**
+     * The upper SiDB of the pair.
+     */
+    typename Lyt::cell upper{};
+    /**
+     * The lower SiDB of the pair.
+     */
+    typename Lyt::cell lower{};
+};
+/**
+ * Ground state simulation engines that can be used to simulate the input patterns of an SiDB gate.
+ */
+enum class input_pattern_simulation_engine
+{
+    /**
+     * Exhaustive ground state simulation (see exhaustive_ground_state_simulation.hpp).
+     */
+    EXGS,
+    /**
+     * *QuickSim* (see quicksim.hpp).
+     */
+    QUICKSIM
+};
+/**
+ * This struct stores the parameters for the simulation of all input patterns of an SiDB gate.
+ */
+struct input_pattern_simulation_params
+{
+    /**
+     * General parameters for the simulation of the physical SiDB system.
+     */
+    sidb_simulation_parameters phys_params{};
+    /**
+     * Ground state simulation engine.
+     */
+    input_pattern_simulation_engine engine{input_pattern_simulation_engine::EXGS};
+    /**
+     * Parameters of *QuickSim* if it is used as the engine. Its physical parameters are replaced by `phys_params`.
+     */
+    quicksim_params quicksim_parameters{};
+    /**
+     * Number of threads to spawn. The input patterns are simulated in parallel. If there are more threads than input
+     * patterns, the remaining threads are distributed among the simulations of the individual input patterns.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
+};
+/**
+ * The simulation result of a single input pattern.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ */
+template <typename Lyt>
+struct input_pattern_result
+{
+    /**
+     * The input pattern, where bit `i` denotes the value of input `i`.
+     */
+    uint64_t pattern{0};
+    /**
+     * The ground state of the layout for this input pattern or `std::nullopt` if no physically valid charge
+     * distribution was found.
+     */
+    std::optional<charge_distribution_surface<Lyt>> ground_state{};
+    /**
+     * Flag that indicates whether all (possibly degenerate) ground states exhibit the specified output values.
+     */
+    bool matched{false};
+};
+/**
+ * This struct stores the results of the simulation of all input patterns of an SiDB gate.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ */
+template <typename Lyt>
+struct input_pattern_simulation_stats
+{
+    /**
+     * Total simulation runtime.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Results of all input patterns in ascending order of the input pattern.
+     */
+    std::vector<input_pattern_result<Lyt>> results{};
+    /**
+     * Report the simulation statistics in a human-readable fashion.
+     *
+     * @param out Output stream to write to.
+     */
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i] total runtime: {:.2f} secs\n", mockturtle::to_seconds(time_total));
+
+        for (const auto& res : results)
+        {
+            if (res.ground_state.has_value())
+            {
+                out << fmt::format("[i] input pattern {:b}: ground state energy {:.4f} eV | {}\n", res.pattern,
+                                   res.ground_state->get_system_energy(), res.matched ? "matched" : "not matched");
+            }
+            else
+            {
+                out << fmt::format("[i] input pattern {:b}: no physically valid charge distribution found\n",
+                                   res.pattern);
+            }
+        }
+    }
+};
+
+namespace detail
+{
+
+template <typename Lyt, typename TT>
+class input_pattern_simulation_impl
+{
+  public:
+    input_pattern_simulation_impl(const Lyt& lyt, const std::vector<sidb_input_overlay<Lyt>>& in,
+                                  const std::vector<sidb_bdl_pair<Lyt>>& out, const std::vector<TT>& tts,
+                                  const input_pattern_simulation_params& p, input_pattern_simulation_stats<Lyt>& st) :
+            base_lyt{lyt},
+            inputs{in},
+            outputs{out},
+            spec{tts},
+            params{p},
+            pst{st},
+            num_patterns{uint64_t{1} << inputs.size()}
+    {}
+
+    bool run()
+    {
+        // the charge-independent model of all SiDBs that occur in any input pattern is computed once and shared by
+        // the simulations of all input patterns
+        return run(create_superset());
+    }
+    /**
+     * Simulates all input patterns based on the given charge-independent model of all SiDBs that occur in any input
+     * pattern. This allows to share the model across several simulations, e.g., of a sweep over physical parameters.
+     *
+     * @param superset Charge distribution surface of all SiDBs of the base layout and all input overlays (see
+     * `create_superset`) whose physical parameters equal the ones of `params`.
+     * @return `true` iff the ground states of all input patterns exhibit the specified output values.
+     */
+    bool run(const charge_distribution_surface<Lyt>& superset)
+    {
+        mockturtle::stopwatch stop{pst.time_total};
+
+        pst.results.resize(num_patterns);
+
+        // If the number of threads is initially set to zero, the simulation is run with one thread.
+        const auto num_threads = std::min(std::max(params.number_threads, uint64_t{1}), num_patterns);
+        // remaining threads are used by the simulations of the individual input patterns
+        const auto threads_per_pattern = std::max(params.number_threads / num_patterns, uint64_t{1});
+
+        if (num_threads == 1)
+        {
+            for (uint64_t pattern = 0; pattern < num_patterns; ++pattern)
+            {
+                pst.results[pattern] = simulate_pattern(pattern, superset, threads_per_pattern);
+            }
+
+            return all_patterns_matched();
+        }
+
+        std::atomic<uint64_t> next_pattern{0};
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (uint64_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(
+                [this, &superset, &next_pattern, threads_per_pattern]
+                {
+                    for (auto pattern = next_pattern.fetch_add(1); pattern < num_patterns;
+                         pattern      = next_pattern.fetch_add(1))
+                    {
+                        pst.results[pattern] = simulate_pattern(pattern, superset, threads_per_pattern);
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        return all_patterns_matched();
+    }
+    /**
+     * Creates the charge distribution surface of all SiDBs of the base layout and all input overlays.
+     *
+     * @return Charge distribution surface with the physical parameters of `params`.
+     */
+    [[nodiscard]] charge_distribution_surface<Lyt> create_superset() const
+    {
+        std::vector<typename Lyt::cell> all_input_sidbs{};
+        for (const auto& in : inputs)
+        {
+            all_input_sidbs.insert(all_input_sidbs.end(), in.sidbs_if_false.cbegin(), in.sidbs_if_false.cend());
+            all_input_sidbs.insert(all_input_sidbs.end(), in.sidbs_if_true.cbegin(), in.sidbs_if_true.cend());
+        }
+
+        return charge_distribution_surface<Lyt>{add_sidbs(all_input_sidbs), params.phys_params};
+    }
+
+  private:
+    /**
+     * The base layout of the gate.
+     */
+    const Lyt& base_lyt;
+    /**
+     * Input overlays.
+     */
+    const std::vector<sidb_input_overlay<Lyt>>& inputs;
+    /**
+     * Output BDL pairs.
+     */
+    const std::vector<sidb_bdl_pair<Lyt>>& outputs;
+    /**
+     * Specification of the gate, i.e., one truth table per output.
+     */
+    const std::vector<TT>& spec;
+    /**
+     * Parameters.
+     */
+    const input_pattern_simulation_params params;
+    /**
+     * Statistics.
+     */
+    input_pattern_simulation_stats<Lyt>& pst;
+    /**
+     * Number of input patterns.
+     */
+    const uint64_t num_patterns;
+
+    /**
+     * Checks whether the ground states of all simulated input patterns exhibit the specified output values.
+     *
+     * @return `true` iff all input patterns matched.
+     */
+    [[nodiscard]] bool all_patterns_matched() const noexcept
+    {
+        return std::all_of(pst.results.cbegin(), pst.results.cend(), [](const auto& res) { return res.matched; });
+    }
+    /**
+     * Creates a new layout that consists of the SiDBs of the base layout and the given ones. Since layouts share their
+     * storage on copy, the base layout is copied cell by cell. SiDB defects of the base layout are copied as well such
+     * that they are taken into account by the simulation.
+     *
+     * @param sidbs SiDBs to add.
+     * @return New layout.
+     */
+    [[nodiscard]] Lyt add_sidbs(const std::vector<typename Lyt::cell>& sidbs) const
+    {
+        Lyt lyt = create_empty_copy(base_lyt);
+
+        base_lyt.foreach_cell([this, &lyt](const auto& c) { lyt.assign_cell_type(c, base_lyt.get_cell_type(c)); });
+
+        for (const auto& c : sidbs)
+        {
+            lyt.assign_cell_type(c, Lyt::cell_type::NORMAL);
+        }
+
+        return lyt;
+    }
+    /**
+     * Creates a layout without cells that has the dimensions, the name, and the tile sizes of the given layout.
+     *
+     * @tparam CellLyt Cell-level layout type.
+     * @param lyt Layout to copy.
+     * @return Copy of `lyt` without cells.
+     */
+    template <typename CellLyt>
+    [[nodiscard]] static CellLyt create_empty_copy(const CellLyt& lyt)
+    {
+        return CellLyt{{lyt.x(), lyt.y(), lyt.z()}, lyt.get_layout_name(), lyt.get_tile_size_x(), lyt.get_tile_size_y()};
+    }
+    /**
+     * Creates an SiDB surface without cells that has the dimensions, the name, the tile sizes, and the parameters of
+     * the given surface as well as its SiDB defects.
+     *
+     * @tparam CellLyt Cell-level layout type underlying the surface.
+     * @param surface SiDB surface to copy.
+     * @return Copy of `surface` without cells.
+     */
+    template <typename CellLyt>
+    [[nodiscard]] static sidb_surface<CellLyt> create_empty_copy(const sidb_surface<CellLyt>& surface)
+    {
+        sidb_surface<CellLyt> lyt{create_empty_copy(static_cast<const CellLyt&>(surface)),
+                                  surface.get_sidb_surface_parameters()};
+
+        surface.foreach_sidb_defect([&lyt](const auto& cd) { lyt.assign_sidb_defect(cd.first, cd.second); });
+
+        return lyt;
+    }
+    /**
+     * Simulates the layout of the given input pattern.
+     *
+     * @param pattern Input pattern.
+     * @param superset Charge distribution surface that holds the charge-independent model of all SiDBs.
+     * @param num_threads Number of threads to use for the simulation.
+     * @return Simulation result of the input pattern.
+     */
+    [[nodiscard]] input_pattern_result<Lyt> simulate_pattern(const uint64_t pattern,
+                                                             const charge_distribution_surface<Lyt>& superset,
+                                                             const uint64_t                          num_threads) const
+    {
+        std::vector<typename Lyt::cell> input_sidbs{};
+        for (uint64_t i = 0; i < inputs.size(); ++i)
+        {
+            const auto& sidbs = ((pattern >> i) & 1u) != 0 ? inputs[i].sidbs_if_true : inputs[i].sidbs_if_false;
+            input_sidbs.insert(input_sidbs.end(), sidbs.cbegin(), sidbs.cend());
+        }
+
+        const charge_distribution_surface<Lyt> charge_lyt{add_sidbs(input_sidbs), superset};
+
+        std::vector<charge_distribution_surface<Lyt>> valid_lyts{};
+
+        switch (params.engine)
+        {
+            case input_pattern_simulation_engine::EXGS:
+            {
+                exgs_params exgs_ps{params.phys_params};
+                exgs_ps.number_threads = num_threads;
+
+                exgs_stats<Lyt> st{};
+                exhaustive_ground_state_simulation_impl<Lyt>{charge_lyt, exgs_ps, st}.run();
+
+                valid_lyts = std::move(st.valid_lyts);
+
+                break;
+            }
+            case input_pattern_simulation_engine::QUICKSIM:
+            {
+                auto quicksim_ps            = params.quicksim_parameters;
+                quicksim_ps.phys_params     = params.phys_params;
+                quicksim_ps.number_threads  = num_threads;
+                quicksim_ps.compact_results = false;
+
+                quicksim_stats<Lyt>              st{};
+                charge_distribution_surface<Lyt> quicksim_lyt{charge_lyt};
+                run_quicksim(quicksim_lyt, quicksim_ps, st);
+
+                valid_lyts = std::move(st.valid_lyts);
+
+                break;
+            }
+        }
+
+        input_pattern_result<Lyt> res{pattern, std::nullopt, false};
+
+        if (valid_lyts.empty())
+        {
+            return res;
+        }
+
+        const auto ground_state = std::min_element(valid_lyts.cbegin(), valid_lyts.cend(),
+                                                   [](const auto& lhs, const auto& rhs)
+                                                   { return lhs.get_system_energy() < rhs.get_system_energy(); });
+
+        const auto min_energy = ground_state->get_system_energy();
+
+        // degenerate ground states have to exhibit the specified output values as well
+        res.matched = std::all_of(valid_lyts.cbegin(), valid_lyts.cend(),
+                                  [this, pattern, min_energy](const auto& valid_lyt)
+                                  {
+                                      return valid_lyt.get_system_energy() >
+                                                 min_energy + physical_constants::POP_STABILITY_ERR ||
+                                             matches_spec(valid_lyt, pattern);
+                                  });
+
+        res.ground_state.emplace(*ground_state);
+
+        return res;
+    }
+    /**
+     * Checks whether the output BDL pairs of the given charge distribution exhibit the specified output values.
+     *
+     * @param charge_lyt Charge distribution.
+     * @param pattern Input pattern.
+     * @return `true` iff all outputs exhibit their specified values.
+     */
+    [[nodiscard]] bool matches_spec(const charge_distribution_surface<Lyt>& charge_lyt,
+                                    const uint64_t                          pattern) const noexcept
+    {
+        for (uint64_t o = 0; o < outputs.size(); ++o)
+        {
+            const auto upper = charge_lyt.get_charge_state(outputs[o].upper);
+            const auto lower = charge_lyt.get_charge_state(outputs[o].lower);
+
+            const auto expected = kitty::get_bit(spec[o], pattern);
+
+            if (expected && !(upper == sidb_charge_state::NEUTRAL && lower == sidb_charge_state::NEGATIVE))
+            {
+                return false;
+            }
+            if (!expected && !(upper == sidb_charge_state::NEGATIVE && lower == sidb_charge_state::NEUTRAL))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Simulates all \f$ 2^k \f$ input patterns of an SiDB gate with \f$ k \f$ inputs and checks whether the ground states
+ * exhibit the specified output values. The layout of each input pattern consists of the gate's base layout and the
+ * SiDBs of the corresponding input overlays (see `sidb_input_overlay`). Instead of recomputing the distance and
+ * potential matrices for each input pattern, they are computed once for all SiDBs that occur in any input pattern and
+ * shared by all simulations. The input patterns are simulated in parallel.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @tparam TT Truth table type.
+ * @param lyt The base layout of the gate, i.e., all SiDBs that are independent of the input values.
+ * @param inputs The input overlays. Input `i` corresponds to variable `i` of the truth tables.
+ * @param outputs The output BDL pairs. Output `o` corresponds to truth table `o` of `spec`.
+ * @param spec The specification of the gate, i.e., one truth table per output.
+ * @param ps Parameters.
+ * @param pst Statistics. They store the simulation results of all input patterns.
+ * @return `true` iff the ground states of all input patterns exhibit the specified output values.
+ */
+template <typename Lyt, typename TT>
+bool simulate_input_patterns(const Lyt& lyt, const std::vector<sidb_input_overlay<Lyt>>& inputs,
+                             const std::vector<sidb_bdl_pair<Lyt>>& outputs, const std::vector<TT>& spec,
+                             const input_pattern_simulation_params& ps  = {},
+                             input_pattern_simulation_stats<Lyt>*   pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
+
+    assert(inputs.size() < 64 && "too many inputs");
+    assert(outputs.size() == spec.size() && "each output requires a truth table");
+    assert(std::all_of(spec.cbegin(), spec.cend(),
+                       [&inputs](const auto& tt) { return tt.num_vars() == inputs.size(); }) &&
+           "the number of variables of all truth tables has to match the number of inputs");
+
+    input_pattern_simulation_stats<Lyt> st{};
+
+    detail::input_pattern_simulation_impl<Lyt, TT> p{lyt, inputs, outputs, spec, ps, st};
+
+    const auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_INPUT_PATTERN_SIMULATION_HPP
@@ -10,11 +10,47 @@
 #include "fiction/algorithms/simulation/sidb/quicksim.hpp"
 #include "fiction/traits.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <optional>
 
 namespace fiction
 {
 
+namespace detail
+{
+
+/**
+ * Determines the minimum energy of the physically valid charge distributions in a simulation's statistics. The
+ * accumulated energy statistics are used if available. Otherwise, e.g., if the statistics were filled by hand, the
+ * minimum is computed from the stored charge distributions.
+ *
+ * @tparam Stats Statistics type of an SiDB simulation.
+ * @param stats Statistics of an SiDB simulation.
+ * @return The minimum energy or `std::nullopt` if no physically valid charge distribution is recorded.
+ */
+template <typename Stats>
+[[nodiscard]] std::optional<double> recorded_minimum_energy(const Stats& stats) noexcept
+{
+    if (!stats.energy_statistics.empty())
+    {
+        return stats.energy_statistics.minimum.get_value();
+    }
+    if (!stats.compact_valid_lyts.empty())
+    {
+        return minimum_energy(stats.compact_valid_lyts);
+    }
+    if (!stats.valid_lyts.empty())
+    {
+        return minimum_energy(stats.valid_lyts);
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace detail
+
 /**
  * This function checks if the ground state is found by the *QuickSim* algorithm.
  *
@@ -32,15 +68,17 @@ template <typename Lyt>
     static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
     static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
 
-    if (exhaustive_results.valid_lyts.empty())
+    const auto min_energy_exact = detail::recorded_minimum_energy(exhaustive_results);
+
+    if (!min_energy_exact.has_value())
     {
         return false;
     }
 
-    const auto min_energy_exact  = minimum_energy(exhaustive_results.valid_lyts);
-    const auto min_energy_new_ap = minimum_energy(quicksim_results.valid_lyts);
+    const auto min_energy_new_ap =
+        detail::recorded_minimum_energy(quicksim_results).value_or(std::numeric_limits<double>::max());
 
-    return std::abs(min_energy_exact - min_energy_new_ap) / min_energy_exact < physical_constants::POP_STABILITY_ERR;
+    return std::abs(*min_energy_exact - min_energy_new_ap) / *min_energy_exact < physical_constants::POP_STABILITY_ERR;
 }
 
 }  // namespace fiction
@@ -6,9 +6,11 @@
 #define FICTION_MINIMUM_ENERGY_HPP
 
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 #include <vector>
 
 namespace fiction
@@ -30,6 +32,22 @@ double minimum_energy(const std::vector<charge_distribution_surface<Lyt>>& charg
     return std::accumulate(charge_lyts.begin(), charge_lyts.end(), std::numeric_limits<double>::max(),
                            [](double a, const auto& lyt) { return std::min(a, lyt.get_system_energy()); });
 }
+/**
+ * Computes the minimum energy of compactly stored charge distributions.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param charge_lyts Compactly stored charge distributions.
+ * @return Value of the minimum energy found in the input collection.
+ */
+template <typename Lyt>
+double minimum_energy(const compact_charge_distributions<Lyt>& charge_lyts) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+    return std::accumulate(charge_lyts.begin(), charge_lyts.end(), std::numeric_limits<double>::max(),
+                           [](double a, const auto& entry) { return std::min(a, entry.system_energy); });
+}
 
 }  // namespace fiction
 
@@ -0,0 +1,369 @@
+#ifndef FICTION_OPERATIONAL_DOMAIN_HPP
+#define FICTION_OPERATIONAL_DOMAIN_HPP
+
+#include "fiction/algorithms/simulation/sidb/input_pattern_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/traits.hpp"
+
+#include <fmt/format.h>
+#include <kitty/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * This struct stores the parameters for the sweep of the physical parameters µ-, epsilon_r, and lambda_tf (see
+ * `sidb_simulation_parameters`) that determines the operational domain of an SiDB gate.
+ */
+struct operational_domain_params
+{
+    /**
+     * Parameters for the simulation of all input patterns at each grid point. The physical parameters that are not
+     * swept, e.g., the lattice constants and the simulation base, are taken from its `phys_params`.
+     */
+    input_pattern_simulation_params simulation_parameters{};
+    /**
+     * Values of the energy transition level µ- (unit: eV). If empty, the value of `simulation_parameters` is used.
+     */
+    std::vector<double> mu_values{};
+    /**
+     * Values of the relative permittivity epsilon_r. If empty, the value of `simulation_parameters` is used.
+     */
+    std::vector<double> epsilon_r_values{};
+    /**
+     * Values of the Thomas-Fermi screening distance lambda_tf (unit: m). If empty, the value of
+     * `simulation_parameters` is used.
+     */
+    std::vector<double> lambda_tf_values{};
+    /**
+     * Number of threads to spawn. The grid points are simulated in parallel. If there are more threads than grid
+     * points, the remaining threads are distributed among the simulations of the individual grid points.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
+};
+/**
+ * A single grid point of the operational domain.
+ */
+struct operational_domain_point
+{
+    /**
+     * Energy transition level µ- (unit: eV).
+     */
+    double mu{};
+    /**
+     * Relative permittivity.
+     */
+    double epsilon_r{};
+    /**
+     * Thomas-Fermi screening distance (unit: m).
+     */
+    double lambda_tf{};
+    /**
+     * Flag that indicates whether the gate implements its specification for these physical parameters.
+     */
+    bool operational{false};
+};
+/**
+ * The operational domain of an SiDB gate, i.e., all grid points of a sweep over physical parameters together with the
+ * information whether the gate is operational at the respective point.
+ */
+struct operational_domain
+{
+    /**
+     * All grid points ordered by epsilon_r, then lambda_tf, and finally µ-, i.e., µ- varies fastest.
+     */
+    std::vector<operational_domain_point> points{};
+};
+/**
+ * This struct stores statistics about the sweep over physical parameters.
+ */
+struct operational_domain_stats
+{
+    /**
+     * Total runtime.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Number of grid points at which the gate is operational.
+     */
+    uint64_t num_operational_points{0};
+    /**
+     * Number of grid points at which the gate is not operational.
+     */
+    uint64_t num_non_operational_points{0};
+    /**
+     * Number of times the potential matrix was derived from the shared SiDB distances. Grid points that only differ in
+     * µ- reuse the potential matrix.
+     */
+    uint64_t num_potential_derivations{0};
+    /**
+     * Report the statistics in a human-readable fashion.
+     *
+     * @param out Output stream to write to.
+     */
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i] total runtime: {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] {} of {} grid points are operational\n", num_operational_points,
+                           num_operational_points + num_non_operational_points);
+        out << fmt::format("[i] the potential matrix was derived {} times\n", num_potential_derivations);
+    }
+};
+
+namespace detail
+{
+
+template <typename Lyt, typename TT>
+class operational_domain_impl
+{
+  public:
+    operational_domain_impl(const Lyt& lyt, const std::vector<sidb_input_overlay<Lyt>>& in,
+                            const std::vector<sidb_bdl_pair<Lyt>>& out, const std::vector<TT>& tts,
+                            const operational_domain_params& p, operational_domain_stats& st) :
+            base_lyt{lyt},
+            inputs{in},
+            outputs{out},
+            spec{tts},
+            params{p},
+            pst{st},
+            mu_values{values_or_default(params.mu_values, params.simulation_parameters.phys_params.mu)},
+            epsilon_r_values{
+                values_or_default(params.epsilon_r_values, params.simulation_parameters.phys_params.epsilon_r)},
+            lambda_tf_values{
+                values_or_default(params.lambda_tf_values, params.simulation_parameters.phys_params.lambda_tf)},
+            num_points{mu_values.size() * epsilon_r_values.size() * lambda_tf_values.size()}
+    {}
+
+    operational_domain run()
+    {
+        mockturtle::stopwatch stop{pst.time_total};
+
+        // the SiDB positions and distances of all SiDBs that occur in any input pattern are computed only once; each
+        // grid point merely re-derives the potentials from them
+        input_pattern_simulation_stats<Lyt> superset_stats{};
+        const auto                          superset = input_pattern_simulation_impl<Lyt, TT>{
+            base_lyt, inputs, outputs, spec, params.simulation_parameters, superset_stats}.create_superset();
+
+        operational_domain domain{};
+        domain.points.resize(num_points);
+
+        // If the number of threads is initially set to zero, the sweep is run with one thread.
+        const auto num_threads = std::min(std::max(params.number_threads, uint64_t{1}), num_points);
+        // remaining threads are used by the simulations of the individual grid points
+        const auto threads_per_point = std::max(params.number_threads / num_points, uint64_t{1});
+
+        std::atomic<uint64_t> next_point{0};
+        std::atomic<uint64_t> num_derivations{0};
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (uint64_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(
+                [this, &superset, &domain, &next_point, &num_derivations, threads_per_point]
+                {
+                    // the surface of the previous grid point is kept since its potentials can be reused if only µ-
+                    // changes, which is likely because µ- varies fastest
+                    std::optional<charge_distribution_surface<Lyt>> charge_lyt{};
+
+                    for (auto point = next_point.fetch_add(1); point < num_points; point = next_point.fetch_add(1))
+                    {
+                        const auto phys_params = physical_parameters_of(point);
+
+                        if (!charge_lyt.has_value() || !same_screening(charge_lyt->get_phys_params(), phys_params))
+                        {
+                            charge_lyt.emplace(superset);
+
+                            if (!same_screening(superset.get_phys_params(), phys_params))
+                            {
+                                num_derivations.fetch_add(1);
+                            }
+                        }
+
+                        charge_lyt->set_physical_parameters(phys_params);
+
+                        domain.points[point] = {phys_params.mu, phys_params.epsilon_r, phys_params.lambda_tf,
+                                                is_operational(*charge_lyt, threads_per_point)};
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        pst.num_operational_points     = static_cast<uint64_t>(std::count_if(
+            domain.points.cbegin(), domain.points.cend(), [](const auto& p) { return p.operational; }));
+        pst.num_non_operational_points = num_points - pst.num_operational_points;
+        pst.num_potential_derivations  = num_derivations.load();
+
+        return domain;
+    }
+
+  private:
+    /**
+     * The base layout of the gate.
+     */
+    const Lyt& base_lyt;
+    /**
+     * Input overlays.
+     */
+    const std::vector<sidb_input_overlay<Lyt>>& inputs;
+    /**
+     * Output BDL pairs.
+     */
+    const std::vector<sidb_bdl_pair<Lyt>>& outputs;
+    /**
+     * Specification of the gate, i.e., one truth table per output.
+     */
+    const std::vector<TT>& spec;
+    /**
+     * Parameters.
+     */
+    const operational_domain_params params;
+    /**
+     * Statistics.
+     */
+    operational_domain_stats& pst;
+    /**
+     * Swept values of µ-, epsilon_r, and lambda_tf.
+     */
+    const std::vector<double> mu_values, epsilon_r_values, lambda_tf_values;
+    /**
+     * Number of grid points.
+     */
+    const uint64_t num_points;
+
+    /**
+     * Returns the given values or the default value if none are given.
+     *
+     * @param values Swept values.
+     * @param default_value Value that is used if `values` is empty.
+     * @return Values to sweep over.
+     */
+    [[nodiscard]] static std::vector<double> values_or_default(const std::vector<double>& values,
+                                                               const double               default_value) noexcept
+    {
+        return values.empty() ? std::vector<double>{default_value} : values;
+    }
+    /**
+     * Checks whether the potentials between SiDBs are identical for both given sets of physical parameters.
+     *
+     * @param lhs First physical parameters.
+     * @param rhs Second physical parameters.
+     * @return `true` iff the potentials do not have to be re-derived.
+     */
+    [[nodiscard]] static bool same_screening(const sidb_simulation_parameters& lhs,
+                                             const sidb_simulation_parameters& rhs) noexcept
+    {
+        return lhs.k == rhs.k && lhs.lambda_tf == rhs.lambda_tf;
+    }
+    /**
+     * Computes the physical parameters of the given grid point.
+     *
+     * @param point Index of the grid point.
+     * @return Physical parameters of `point`.
+     */
+    [[nodiscard]] sidb_simulation_parameters physical_parameters_of(const uint64_t point) const noexcept
+    {
+        const auto mu        = mu_values[point % mu_values.size()];
+        const auto lambda_tf = lambda_tf_values[(point / mu_values.size()) % lambda_tf_values.size()];
+        const auto epsilon_r = epsilon_r_values[point / (mu_values.size() * lambda_tf_values.size())];
+
+        const auto& base_params = params.simulation_parameters.phys_params;
+
+        // the derived parameters, i.e., µ+ and k, are computed by the constructor
+        sidb_simulation_parameters phys_params{base_params.base,  mu,
+                                               epsilon_r,         lambda_tf,
+                                               base_params.lat_a, base_params.lat_b,
+                                               base_params.lat_c};
+        phys_params.cutoff_radius = base_params.cutoff_radius;
+
+        return phys_params;
+    }
+    /**
+     * Checks whether the gate implements its specification for the physical parameters of the given surface.
+     *
+     * @param superset Charge distribution surface of all SiDBs that occur in any input pattern.
+     * @param num_threads Number of threads to use for the simulation of the input patterns.
+     * @return `true` iff the ground states of all input patterns exhibit the specified output values.
+     */
+    [[nodiscard]] bool is_operational(const charge_distribution_surface<Lyt>& superset,
+                                      const uint64_t                          num_threads) const
+    {
+        auto simulation_params           = params.simulation_parameters;
+        simulation_params.phys_params    = superset.get_phys_params();
+        simulation_params.number_threads = num_threads;
+
+        input_pattern_simulation_stats<Lyt> st{};
+
+        return input_pattern_simulation_impl<Lyt, TT>{base_lyt, inputs, outputs, spec, simulation_params, st}.run(
+            superset);
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Determines the operational domain of an SiDB gate, i.e., all points of a grid over the physical parameters µ-,
+ * epsilon_r, and lambda_tf at which the ground states of all input patterns exhibit the specified output values (see
+ * `simulate_input_patterns`).
+ *
+ * The positions of and distances between all SiDBs that occur in any input pattern are computed only once. At each
+ * grid point, only the potentials are re-derived from the distances, which is skipped entirely if a thread's previous
+ * grid point only differed in µ-. The grid points are distributed among threads.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @tparam TT Truth table type.
+ * @param lyt The base layout of the gate, i.e., all SiDBs that are independent of the input values.
+ * @param inputs The input overlays. Input `i` corresponds to variable `i` of the truth tables.
+ * @param outputs The output BDL pairs. Output `o` corresponds to truth table `o` of `spec`.
+ * @param spec The specification of the gate, i.e., one truth table per output.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return The operational domain of the gate.
+ */
+template <typename Lyt, typename TT>
+operational_domain determine_operational_domain(const Lyt& lyt, const std::vector<sidb_input_overlay<Lyt>>& inputs,
+                                                const std::vector<sidb_bdl_pair<Lyt>>& outputs,
+                                                const std::vector<TT>& spec, const operational_domain_params& ps = {},
+                                                operational_domain_stats* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+    static_assert(kitty::is_truth_table<TT>::value, "TT is not a truth table");
+
+    assert(inputs.size() < 64 && "too many inputs");
+    assert(outputs.size() == spec.size() && "each output requires a truth table");
+
+    operational_domain_stats st{};
+
+    detail::operational_domain_impl<Lyt, TT> p{lyt, inputs, outputs, spec, ps, st};
+
+    auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_OPERATIONAL_DOMAIN_HPP
@@ -6,20 +6,30 @@
 #define FICTION_QUICKSIM_HPP
 
 #include "fiction/algorithms/simulation/sidb/energy_distribution.hpp"
+#include "fiction/algorithms/simulation/sidb/energy_statistics.hpp"
 #include "fiction/algorithms/simulation/sidb/minimum_energy.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
 #include "fiction/traits.hpp"
 
 #include <fmt/format.h>
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <random>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 namespace fiction
@@ -46,6 +56,48 @@ struct quicksim_params
      * Number of threads to spawn. By default the number of threads is set to the number of available hardware threads.
      */
     uint64_t number_threads{std::thread::hardware_concurrency()};
+    /**
+     * If set, the physically valid charge distributions are stored compactly in `quicksim_stats::compact_valid_lyts`
+     * instead of as full charge distribution surfaces in `quicksim_stats::valid_lyts`.
+     */
+    bool compact_results{false};
+    /**
+     * Seed for the random number generators. Each thread draws from its own random number stream that is derived from
+     * this seed and the thread's index. Hence, the simulation results are reproducible for a given seed and number of
+     * threads unless the simulation is terminated early (see `timeout` and `plateau_iterations`). If no seed is given,
+     * a random one is used.
+     */
+    std::optional<uint64_t> seed{};
+    /**
+     * Wall-clock time budget in ms. Once it is exceeded, the simulation is terminated early and returns all physically
+     * valid charge distributions found so far. By default, the simulation is not time-limited.
+     */
+    uint64_t timeout{std::numeric_limits<uint64_t>::max()};
+    /**
+     * The simulation is terminated early once the minimum energy found has not improved for this many consecutive
+     * iterations (counted across all threads). `0` disables this criterion.
+     */
+    uint64_t plateau_iterations{0};
+    /**
+     * Callback that is invoked whenever a physically valid charge distribution is found whose system energy is lower
+     * than that of all previously found ones. It receives the charge states of all SiDBs (in the order of the SiDB
+     * indices of `charge_distribution_surface`) and the system energy. The callback is invoked from the worker threads,
+     * but never concurrently.
+     */
+    std::function<void(const std::vector<sidb_charge_state>&, double)> new_minimum_callback{};
+    /**
+     * Number of physically valid charge distributions with the lowest system energies that are retained in
+     * `quicksim_stats::energy_statistics`.
+     */
+    uint64_t num_lowest_energy_states{1};
+    /**
+     * If set, the search is carried out on a charge distribution surface that stores its potentials in single
+     * precision, which halves the memory traffic of the vectorized kernels and doubles the number of SiDBs they process
+     * per instruction. Each charge distribution that is physically valid in single precision is verified in double
+     * precision before it is stored such that all results are physically valid in double precision. Charge
+     * distributions whose validity is decided by less than the single-precision rounding error may be missed.
+     */
+    bool single_precision{false};
 };
 
 /**
@@ -64,158 +116,373 @@ struct quicksim_stats
      * Vector of all physically valid charge layouts.
      */
     std::vector<charge_distribution_surface<Lyt>> valid_lyts{};
+    /**
+     * Physically valid charge distributions that are stored compactly if `quicksim_params::compact_results` is set.
+     */
+    compact_charge_distributions<Lyt> compact_valid_lyts{};
+    /**
+     * Number of iterations that were completed before the simulation terminated.
+     */
+    uint64_t completed_iterations{0};
+    /**
+     * Flag that indicates whether the simulation was terminated early because the time budget was exceeded or the
+     * minimum energy reached a plateau (see `quicksim_params`).
+     */
+    bool terminated_early{false};
+    /**
+     * Statistics of all physically valid charge distributions that are accumulated during the simulation.
+     */
+    sidb_energy_statistics<Lyt> energy_statistics{};
     /**
      * Report the simulation statistics in a human-readable fashion.
      *
      * @param out Output stream to write to.
      */
-    void report(std::ostream& out = std::cout)
+    void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total runtime: {:.2f} secs\n", mockturtle::to_seconds(time_total));
 
-        if (!energy_distribution<Lyt>(valid_lyts).empty())
+        if (!energy_statistics.empty())
         {
-            for (auto [energy, count] : energy_distribution<Lyt>(valid_lyts))
+            out << fmt::format("[i] lowest energy state: {:.4f} meV \n", energy_statistics.minimum.get_value());
+
+            for (const auto& [energy, count] : energy_statistics.histogram.get_distribution())
             {
-                out << fmt::format("[i] lowest energy state: {:.4f} meV \n", minimum_energy(valid_lyts));
                 out << fmt::format("[i] energy: {} | occurrence: {} \n", energy, count);
             }
         }
         else
         {
-            std::cout << "no state found" << std::endl;
+            out << "no state found" << std::endl;
         }
 
-        std::cout << "_____________________________________________________ \n";
+        out << "_____________________________________________________ \n";
     }
 };
 
+namespace detail
+{
+
 /**
- * The *QuickSim* algorithm is an electrostatic ground state simulation algorithm for SiDB layouts. It determines
- * physically valid charge configurations (with minimal energy) of a given (already initialized) charge distribution
- * layout. Depending on the simulation parameters, the ground state is found with a certain probability after one run.
+ * Runs the search of *QuickSim* on the given charge distribution surface, whose potentials are stored in `FloatType`.
+ * If `FloatType` is not `double`, each charge distribution that is found to be physically valid is verified on a copy
+ * of `verification_lyt` before it is stored.
  *
  * @tparam Lyt Cell-level layout type.
- * @param lyt The layout to simulate.
- * @param ps Physical parameters. They are material-specific and may vary from experiment to experiment.
- * @param pst Statistics. They store the simulation results (simulation runtime as well as all physically valid charge
- * distribution layouts).
+ * @tparam FloatType Floating-point type of the potentials of `charge_lyt`.
+ * @param charge_lyt Charge distribution surface on which the search is carried out. Its charge distribution is altered.
+ * @param verification_lyt Charge distribution surface in double precision of the same layout. Its charge distribution
+ * is altered if `FloatType` is not `double`.
+ * @param ps *QuickSim* parameters.
+ * @param st Statistics to store the physically valid charge distributions in. The runtime is not measured.
  */
-template <typename Lyt>
-void quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}, quicksim_stats<Lyt>* pst = nullptr)
+template <typename Lyt, typename FloatType>
+void run_quicksim_search(charge_distribution_surface<Lyt, false, FloatType>& charge_lyt,
+                         charge_distribution_surface<Lyt>& verification_lyt, const quicksim_params& ps,
+                         quicksim_stats<Lyt>& st)
 {
-    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
-    static_assert(has_sidb_technology_v<Lyt>, "Lyt must be an SiDB layout");
-
-    quicksim_stats<Lyt> st{};
     st.valid_lyts.reserve(ps.interation_steps);
 
-    // measure run time (artificial scope)
+    const auto start_time = std::chrono::steady_clock::now();
+
+    if (ps.compact_results)
     {
-        mockturtle::stopwatch stop{st.time_total};
+        st.compact_valid_lyts = compact_charge_distributions<Lyt>{
+            std::make_shared<const charge_distribution_surface<Lyt>>(verification_lyt)};
+    }
 
-        charge_distribution_surface charge_lyt{lyt};
+    st.energy_statistics = sidb_energy_statistics<Lyt>{ps.num_lowest_energy_states};
 
-        // set the given physical parameters
-        charge_lyt.set_physical_parameters(ps.phys_params);
+    const auto store_valid_lyt = [&ps](const charge_distribution_surface<Lyt>& valid_lyt, quicksim_stats<Lyt>& res)
+    {
+        res.energy_statistics.add(valid_lyt);
 
-        charge_lyt.set_all_charge_states(sidb_charge_state::NEGATIVE);
-        charge_lyt.update_after_charge_change();
-        const auto negative_sidb_indices = charge_lyt.negative_sidb_detection();
+        if (ps.compact_results)
+        {
+            valid_lyt.charge_distribution_to_index();
+            res.compact_valid_lyts.add(valid_lyt);
+        }
+        else
+        {
+            res.valid_lyts.push_back(charge_distribution_surface<Lyt>{valid_lyt});
+        }
+    };
+
+    // lowest system energy found so far; it is only written while holding the mutex
+    std::atomic<double> min_energy{std::numeric_limits<double>::infinity()};
+    std::mutex          min_energy_mutex{};
+    // number of completed iterations in total and since the minimum energy was last improved
+    std::atomic<uint64_t> completed_iterations{0};
+    std::atomic<uint64_t> iterations_without_improvement{0};
+    // set if the simulation is to be terminated early
+    std::atomic<bool> terminate{false};
+
+    const auto update_minimum_energy = [&](const charge_distribution_surface<Lyt>& valid_lyt)
+    {
+        const auto energy = valid_lyt.get_system_energy();
 
-        if (charge_lyt.is_physically_valid())
+        // the mutex is only acquired if the energy is likely to be an improvement
+        if (energy >= min_energy.load() - physical_constants::POP_STABILITY_ERR)
         {
-            st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+            return;
         }
 
-        charge_lyt.set_all_charge_states(sidb_charge_state::NEUTRAL);
-        charge_lyt.update_after_charge_change();
+        const std::lock_guard lock{min_energy_mutex};
 
-        if (!negative_sidb_indices.empty())
+        if (energy < min_energy.load() - physical_constants::POP_STABILITY_ERR)
         {
-            if (charge_lyt.is_physically_valid())
+            min_energy.store(energy);
+            iterations_without_improvement.store(0);
+
+            if (ps.new_minimum_callback)
             {
-                st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt});
+                ps.new_minimum_callback(valid_lyt.get_all_sidb_charges(), energy);
             }
         }
+    };
 
-        // If the number of threads is initially set to zero, the simulation is run with one thread.
-        const uint64_t num_threads = std::max(ps.number_threads, uint64_t{1});
+    const auto store_if_valid = [&store_valid_lyt, &update_minimum_energy](
+                                    const charge_distribution_surface<Lyt, false, FloatType>& candidate,
+                                    [[maybe_unused]] charge_distribution_surface<Lyt>&        verification,
+                                    quicksim_stats<Lyt>&                                      res)
+    {
+        if (!candidate.is_physically_valid())
+        {
+            return;
+        }
 
-        // split the iterations among threads
-        const auto iter_per_thread =
-            std::max(ps.interation_steps / num_threads,
-                     uint64_t{1});  // If the number of set threads is greater than the number of iterations, the
-                                    // number of threads defines how many times QuickSim is repeated
+        if constexpr (std::is_same_v<FloatType, double>)
+        {
+            store_valid_lyt(candidate, res);
+            update_minimum_energy(candidate);
+        }
+        else
+        {
+            // only the SiDBs whose charge state differs are reassigned such that the update is incremental
+            for (uint64_t i = 0u; i < candidate.num_cells(); ++i)
+            {
+                if (const auto cs = candidate.get_charge_state_by_index(i);
+                    verification.get_charge_state_by_index(i) != cs)
+                {
+                    verification.assign_charge_state_by_cell_index(i, cs, false);
+                }
+            }
 
-        std::vector<std::thread> threads{};
-        threads.reserve(num_threads);
-        std::mutex mutex{};  // used to control access to shared resources
+            verification.update_after_charge_change();
 
-        for (uint64_t z = 0ul; z < num_threads; z++)
+            if (verification.is_physically_valid())
+            {
+                store_valid_lyt(verification, res);
+                update_minimum_energy(verification);
+            }
+        }
+    };
+
+    const auto time_budget_exceeded = [&start_time, &ps]
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                         std::chrono::steady_clock::now() - start_time)
+                                         .count()) >= ps.timeout;
+    };
+
+    charge_lyt.set_all_charge_states(sidb_charge_state::NEGATIVE);
+    charge_lyt.update_after_charge_change();
+    const auto negative_sidb_indices = charge_lyt.negative_sidb_detection();
+
+    store_if_valid(charge_lyt, verification_lyt, st);
+
+    charge_lyt.set_all_charge_states(sidb_charge_state::NEUTRAL);
+    charge_lyt.update_after_charge_change();
+
+    if (!negative_sidb_indices.empty())
+    {
+        store_if_valid(charge_lyt, verification_lyt, st);
+    }
+
+    // lookup table of the SiDBs that have to be negatively charged; it is read concurrently but never written
+    std::vector<bool> is_negative_sidb(charge_lyt.num_cells(), false);
+    for (const auto& index : negative_sidb_indices)
+    {
+        is_negative_sidb[static_cast<uint64_t>(index)] = true;
+    }
+
+    // If the number of threads is initially set to zero, the simulation is run with one thread.
+    const uint64_t num_threads = std::max(ps.number_threads, uint64_t{1});
+
+    // split the iterations among threads
+    const auto iter_per_thread =
+        std::max(ps.interation_steps / num_threads,
+                 uint64_t{1});  // If the number of set threads is greater than the number of iterations, the
+                                // number of threads defines how many times QuickSim is repeated
+
+    const uint64_t seed = ps.seed.has_value() ? *ps.seed : std::random_device{}();
+
+    // each thread stores its results in its own buffer such that no synchronization is required
+    std::vector<quicksim_stats<Lyt>> thread_results(num_threads);
+
+    for (auto& res : thread_results)
+    {
+        if (ps.compact_results)
         {
-            threads.emplace_back(
-                [&]
-                {
-                    charge_distribution_surface<Lyt> charge_lyt_copy{charge_lyt};
+            res.compact_valid_lyts = compact_charge_distributions<Lyt>{st.compact_valid_lyts.get_model()};
+        }
 
-                    for (uint64_t l = 0ul; l < iter_per_thread; ++l)
+        res.energy_statistics = sidb_energy_statistics<Lyt>{ps.num_lowest_energy_states};
+    }
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads);
+
+    for (uint64_t z = 0ul; z < num_threads; z++)
+    {
+        threads.emplace_back(
+            [&, z]
+            {
+                charge_distribution_surface<Lyt, false, FloatType> charge_lyt_copy{charge_lyt};
+                charge_distribution_surface<Lyt>            verification_copy{verification_lyt};
+
+                auto& res = thread_results[z];
+
+                // the random number stream of this thread only depends on the seed and the thread's index
+                std::seed_seq   seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32u),
+                                  static_cast<uint32_t>(z)};
+                std::mt19937_64 generator{seq};
+
+                for (uint64_t l = 0ul; l < iter_per_thread && !terminate.load(); ++l)
+                {
+                    for (uint64_t i = 0ul; i < charge_lyt.num_cells(); ++i)
                     {
-                        for (uint64_t i = 0ul; i < charge_lyt.num_cells(); ++i)
+                        if (is_negative_sidb[i])
                         {
-                            {
-                                const std::lock_guard lock{mutex};
-                                if (std::find(negative_sidb_indices.cbegin(), negative_sidb_indices.cend(), i) !=
-                                    negative_sidb_indices.cend())
-                                {
-                                    continue;
-                                }
-                            }
-
-                            std::vector<uint64_t> index_start{i};
-
-                            charge_lyt_copy.set_all_charge_states(sidb_charge_state::NEUTRAL);
-
-                            for (const auto& index : negative_sidb_indices)
-                            {
-                                charge_lyt_copy.assign_charge_state_by_cell_index(static_cast<uint64_t>(index),
-                                                                                  sidb_charge_state::NEGATIVE);
-                                index_start.push_back(static_cast<uint64_t>(index));
-                            }
-
-                            charge_lyt_copy.assign_charge_state_by_cell_index(i, sidb_charge_state::NEGATIVE);
-                            charge_lyt_copy.update_after_charge_change();
-
-                            if (charge_lyt_copy.is_physically_valid())
-                            {
-                                const std::lock_guard lock{mutex};
-                                st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt_copy});
-                            }
-
-                            const auto upper_limit =
-                                std::min(static_cast<uint64_t>(static_cast<double>(charge_lyt_copy.num_cells()) / 1.5),
-                                         charge_lyt.num_cells() - negative_sidb_indices.size());
-
-                            for (uint64_t num = 0ul; num < upper_limit; num++)
-                            {
-                                charge_lyt_copy.adjacent_search(ps.alpha, index_start);
-                                charge_lyt_copy.validity_check();
-
-                                if (charge_lyt_copy.is_physically_valid())
-                                {
-                                    const std::lock_guard lock{mutex};
-                                    st.valid_lyts.push_back(charge_distribution_surface<Lyt>{charge_lyt_copy});
-                                }
-                            }
+                            continue;
+                        }
+
+                        if (terminate.load() || time_budget_exceeded())
+                        {
+                            terminate.store(true);
+
+                            break;
+                        }
+
+                        std::vector<uint64_t> index_start{i};
+
+                        charge_lyt_copy.set_all_charge_states(sidb_charge_state::NEUTRAL);
+
+                        for (const auto& index : negative_sidb_indices)
+                        {
+                            charge_lyt_copy.assign_charge_state_by_cell_index(static_cast<uint64_t>(index),
+                                                                              sidb_charge_state::NEGATIVE);
+                            index_start.push_back(static_cast<uint64_t>(index));
+                        }
+
+                        charge_lyt_copy.assign_charge_state_by_cell_index(i, sidb_charge_state::NEGATIVE);
+                        charge_lyt_copy.update_after_charge_change();
+
+                        store_if_valid(charge_lyt_copy, verification_copy, res);
+
+                        const auto upper_limit =
+                            std::min(static_cast<uint64_t>(static_cast<double>(charge_lyt_copy.num_cells()) / 1.5),
+                                     charge_lyt.num_cells() - negative_sidb_indices.size());
+
+                        for (uint64_t num = 0ul; num < upper_limit; num++)
+                        {
+                            charge_lyt_copy.adjacent_search(ps.alpha, index_start, generator);
+                            charge_lyt_copy.validity_check();
+
+                            store_if_valid(charge_lyt_copy, verification_copy, res);
                         }
                     }
-                });
-        }
 
-        for (auto& thread : threads)
-        {
-            thread.join();
-        }
+                    if (terminate.load())
+                    {
+                        break;
+                    }
+
+                    completed_iterations.fetch_add(1);
+
+                    if (ps.plateau_iterations != 0 &&
+                        iterations_without_improvement.fetch_add(1) + 1 >= ps.plateau_iterations)
+                    {
+                        terminate.store(true);
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // merge the results in the order of the threads such that they are reproducible
+    for (auto& res : thread_results)
+    {
+        st.valid_lyts.insert(st.valid_lyts.end(), std::make_move_iterator(res.valid_lyts.begin()),
+                             std::make_move_iterator(res.valid_lyts.end()));
+        st.compact_valid_lyts.append(res.compact_valid_lyts);
+        st.energy_statistics.merge(res.energy_statistics);
+    }
+
+    st.completed_iterations = completed_iterations.load();
+    st.terminated_early     = terminate.load() && st.completed_iterations < iter_per_thread * num_threads;
+}
+/**
+ * Runs *QuickSim* on the given charge distribution surface, which already holds the charge-independent model of the
+ * layout to simulate. This allows several simulations to share one model (see `charge_distribution_surface`). If
+ * `quicksim_params::single_precision` is set, the search is carried out on a single-precision copy of `charge_lyt`.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param charge_lyt Charge distribution surface of the layout to simulate. Its charge distribution is altered.
+ * @param ps *QuickSim* parameters. The physical parameters of `charge_lyt` are used instead of `ps.phys_params`.
+ * @param st Statistics to store the physically valid charge distributions in. The runtime is not measured.
+ */
+template <typename Lyt>
+void run_quicksim(charge_distribution_surface<Lyt>& charge_lyt, const quicksim_params& ps, quicksim_stats<Lyt>& st)
+{
+    if (ps.single_precision)
+    {
+        charge_distribution_surface<Lyt, false, float> single_precision_lyt{charge_lyt};
+
+        run_quicksim_search(single_precision_lyt, charge_lyt, ps, st);
+    }
+    else
+    {
+        run_quicksim_search(charge_lyt, charge_lyt, ps, st);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * The *QuickSim* algorithm is an electrostatic ground state simulation algorithm for SiDB layouts. It determines
+ * physically valid charge configurations (with minimal energy) of a given (already initialized) charge distribution
+ * layout. Depending on the simulation parameters, the ground state is found with a certain probability after one run.
+ *
+ * Besides a fixed number of iterations, the simulation can be given a time budget and a convergence criterion (see
+ * `quicksim_params`) after which it returns the best charge distributions found so far. Each new lowest-energy charge
+ * distribution can be reported via a callback as soon as it is found.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Physical parameters. They are material-specific and may vary from experiment to experiment.
+ * @param pst Statistics. They store the simulation results (simulation runtime as well as all physically valid charge
+ * distribution layouts).
+ */
+template <typename Lyt>
+void quicksim(const Lyt& lyt, const quicksim_params& ps = quicksim_params{}, quicksim_stats<Lyt>* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt must be an SiDB layout");
+
+    quicksim_stats<Lyt> st{};
+
+    // measure run time (artificial scope)
+    {
+        mockturtle::stopwatch stop{st.time_total};
+
+        charge_distribution_surface<Lyt> charge_lyt{lyt, ps.phys_params};
+
+        detail::run_quicksim(charge_lyt, ps, st);
     }
 
     if (pst)
@@ -0,0 +1,396 @@
+#ifndef FICTION_SIDB_SIMULATED_ANNEALING_HPP
+#define FICTION_SIDB_SIMULATED_ANNEALING_HPP
+
+#include "fiction/algorithms/optimization/simulated_annealing.hpp"
+#include "fiction/algorithms/simulation/sidb/quicksim.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/traits.hpp"
+
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * This struct stores the parameters for the simulated annealing-based SiDB ground state simulation.
+ */
+struct sidb_simulated_annealing_params
+{
+    /**
+     * General parameters for the simulation of the physical SiDB system.
+     */
+    sidb_simulation_parameters phys_params{};
+    /**
+     * Initial temperature in eV.
+     */
+    double initial_temperature{0.5};
+    /**
+     * Final temperature in eV. The temperature is decreased geometrically (see `geometric_temperature_schedule`).
+     */
+    double final_temperature{0.001};
+    /**
+     * Number of moves per temperature value.
+     */
+    uint64_t cycles{10};
+    /**
+     * Number of independent annealing instances, each starting from a random charge distribution.
+     */
+    uint64_t instances{16};
+    /**
+     * Probability with which a move is a hop of a charge between two SiDBs instead of a change of the charge state of a
+     * single SiDB.
+     */
+    double hop_probability{0.5};
+    /**
+     * Number of threads to spawn. By default the number of threads is set to the number of available hardware threads.
+     */
+    uint64_t number_threads{std::thread::hardware_concurrency()};
+    /**
+     * If set, the physically valid charge distributions are stored compactly in `quicksim_stats::compact_valid_lyts`
+     * instead of as full charge distribution surfaces in `quicksim_stats::valid_lyts`.
+     */
+    bool compact_results{false};
+    /**
+     * Number of physically valid charge distributions with the lowest system energies that are retained in
+     * `quicksim_stats::energy_statistics`.
+     */
+    uint64_t num_lowest_energy_states{1};
+    /**
+     * Seed for the random number generators. Each annealing instance draws its initial state, its moves, and the
+     * acceptance of worse states from its own random number stream that is derived from this seed and the instance's
+     * index. Hence, the same charge distributions are found for a given seed regardless of the number of threads. If no
+     * seed is given, a random one is used.
+     */
+    std::optional<uint64_t> seed{};
+};
+
+namespace detail
+{
+
+/**
+ * A charge distribution that is subject to simulated annealing.
+ *
+ * @tparam Lyt Cell-level layout type.
+ */
+template <typename Lyt>
+struct sidb_annealing_state
+{
+    /**
+     * Charge distribution whose local potentials and electrostatic energy are kept up to date.
+     */
+    charge_distribution_surface<Lyt> charge_lyt{};
+    /**
+     * Energy required to move the SiDBs' charges from the bulk, i.e., \f$ \mu_- \f$ per negative SiDB and \f$ -\mu_+
+     * \f$ per positive SiDB. Its sum with the electrostatic energy is the grand potential that is minimized. Hence,
+     * minima with respect to single charge state changes fulfill *Population Stability* and minima with respect to
+     * charge hops fulfill *Configuration Stability*.
+     */
+    double chemical_potential_energy{0.0};
+};
+
+template <typename Lyt>
+class sidb_simulated_annealing_impl
+{
+  public:
+    sidb_simulated_annealing_impl(const Lyt& lyt, const sidb_simulated_annealing_params& p, quicksim_stats<Lyt>& st) :
+            charge_lyt{lyt, p.phys_params},
+            params{p},
+            pst{st},
+            num_sidbs{charge_lyt.num_cells()}
+    {}
+
+    void run()
+    {
+        mockturtle::stopwatch stop{pst.time_total};
+
+        if (params.compact_results)
+        {
+            pst.compact_valid_lyts =
+                compact_charge_distributions<Lyt>{std::make_shared<const charge_distribution_surface<Lyt>>(charge_lyt)};
+        }
+
+        pst.energy_statistics = sidb_energy_statistics<Lyt>{params.num_lowest_energy_states};
+
+        if (num_sidbs == 0 || params.instances == 0)
+        {
+            return;
+        }
+
+        // If the number of threads is initially set to zero, the simulation is run with one thread.
+        const auto num_threads = std::min(std::max(params.number_threads, uint64_t{1}), params.instances);
+
+        // each thread stores its results in its own buffer such that no synchronization is required
+        std::vector<quicksim_stats<Lyt>> thread_results(num_threads);
+
+        for (auto& res : thread_results)
+        {
+            res.compact_valid_lyts = compact_charge_distributions<Lyt>{pst.compact_valid_lyts.get_model()};
+            res.energy_statistics  = pst.energy_statistics;
+        }
+
+        const uint64_t seed = params.seed.has_value() ? *params.seed : std::random_device{}();
+
+        std::atomic<uint64_t> next_instance{0};
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_threads);
+
+        for (uint64_t t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back(
+                [this, seed, &next_instance, &res = thread_results[t]]
+                {
+                    while (true)
+                    {
+                        const auto instance = next_instance.fetch_add(1);
+
+                        if (instance >= params.instances)
+                        {
+                            break;
+                        }
+
+                        // the random number stream of this instance only depends on the seed and the instance's index
+                        std::seed_seq   seq{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32u),
+                                          static_cast<uint32_t>(instance)};
+                        std::mt19937_64 generator{seq};
+
+                        anneal(generator, res);
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // merge the results in the order of the threads
+        for (auto& res : thread_results)
+        {
+            pst.valid_lyts.insert(pst.valid_lyts.end(), std::make_move_iterator(res.valid_lyts.begin()),
+                                  std::make_move_iterator(res.valid_lyts.end()));
+            pst.compact_valid_lyts.append(res.compact_valid_lyts);
+            pst.energy_statistics.merge(res.energy_statistics);
+        }
+
+        pst.completed_iterations = params.instances;
+    }
+
+  private:
+    /**
+     * Charge distribution surface that holds the charge-independent model shared by all annealing states.
+     */
+    charge_distribution_surface<Lyt> charge_lyt;
+    /**
+     * Parameters.
+     */
+    const sidb_simulated_annealing_params params;
+    /**
+     * Statistics.
+     */
+    quicksim_stats<Lyt>& pst;
+    /**
+     * Number of SiDBs.
+     */
+    const uint64_t num_sidbs;
+
+    using state = sidb_annealing_state<Lyt>;
+
+    /**
+     * Computes the chemical potential energy of a charge state (see `sidb_annealing_state`).
+     *
+     * @param cs Charge state.
+     * @return Chemical potential energy of an SiDB in charge state `cs`.
+     */
+    [[nodiscard]] double chemical_potential_energy(const sidb_charge_state cs) const noexcept
+    {
+        switch (cs)
+        {
+            case sidb_charge_state::NEGATIVE:
+            {
+                return params.phys_params.mu;
+            }
+            case sidb_charge_state::POSITIVE:
+            {
+                return -params.phys_params.mu_p;
+            }
+            default:
+            {
+                return 0.0;
+            }
+        }
+    }
+    /**
+     * Draws a charge state uniformly at random from the charge states allowed by the base number.
+     *
+     * @param generator Random number generator.
+     * @return Random charge state.
+     */
+    [[nodiscard]] sidb_charge_state random_charge_state(std::mt19937_64& generator) const noexcept
+    {
+        std::uniform_int_distribution<int> dist{-1, params.phys_params.base == 3 ? 1 : 0};
+
+        return sign_to_charge_state(static_cast<int8_t>(dist(generator)));
+    }
+    /**
+     * Assigns a charge state to an SiDB of the given state and updates its chemical potential energy. The local
+     * potentials and the electrostatic energy are not updated.
+     *
+     * @param s Annealing state.
+     * @param index Index of the SiDB.
+     * @param cs Charge state to assign.
+     */
+    void assign_charge_state(state& s, const uint64_t index, const sidb_charge_state cs) const noexcept
+    {
+        s.chemical_potential_energy += chemical_potential_energy(cs) -
+                                       chemical_potential_energy(s.charge_lyt.get_charge_state_by_index(index));
+        s.charge_lyt.assign_charge_state_by_cell_index(index, cs, false);
+    }
+    /**
+     * Runs a single annealing instance from a random charge distribution and stores the resulting charge distribution
+     * if it is physically valid.
+     *
+     * @param generator Random number generator.
+     * @param res Result buffer of the calling thread.
+     */
+    void anneal(std::mt19937_64& generator, quicksim_stats<Lyt>& res) const
+    {
+        state init_state{charge_distribution_surface<Lyt>{charge_lyt}, 0.0};
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            assign_charge_state(init_state, i, random_charge_state(generator));
+        }
+
+        init_state.charge_lyt.update_local_potential();
+        init_state.charge_lyt.recompute_system_energy();
+
+        std::uniform_int_distribution<uint64_t> sidb_dist{0, num_sidbs - 1};
+        std::bernoulli_distribution             hop_dist{num_sidbs > 1 ? params.hop_probability : 0.0};
+
+        // a move either hops a charge between two SiDBs or changes the charge state of a single SiDB; in both cases,
+        // the local potentials and the energy are updated incrementally in O(n)
+        const auto next = [this, &generator, &sidb_dist, &hop_dist](const state& s)
+        {
+            state n{s};
+
+            const auto i    = sidb_dist(generator);
+            const auto cs_i = n.charge_lyt.get_charge_state_by_index(i);
+
+            if (hop_dist(generator))
+            {
+                const auto j = sidb_dist(generator);
+
+                if (const auto cs_j = n.charge_lyt.get_charge_state_by_index(j); cs_i != cs_j)
+                {
+                    assign_charge_state(n, i, cs_j);
+                    assign_charge_state(n, j, cs_i);
+                }
+            }
+            else
+            {
+                auto cs = random_charge_state(generator);
+
+                while (cs == cs_i)
+                {
+                    cs = random_charge_state(generator);
+                }
+
+                assign_charge_state(n, i, cs);
+            }
+
+            n.charge_lyt.update_local_potential_incrementally();
+            n.charge_lyt.recompute_system_energy();
+
+            return n;
+        };
+
+        const auto grand_potential = [](const state& s)
+        { return s.charge_lyt.get_system_energy() + s.chemical_potential_energy; };
+
+        auto [best_state, best_cost] =
+            simulated_annealing(init_state, params.initial_temperature, params.final_temperature, params.cycles,
+                                grand_potential, geometric_temperature_schedule, next, generator);
+
+        auto& result = best_state.charge_lyt;
+
+        // remove accumulated rounding errors of the incremental updates before the validity is checked
+        result.update_local_potential();
+        result.recompute_system_energy();
+        result.validity_check();
+
+        if (!result.is_physically_valid())
+        {
+            return;
+        }
+
+        res.energy_statistics.add(result);
+
+        if (params.compact_results)
+        {
+            result.charge_distribution_to_index();
+            res.compact_valid_lyts.add(result);
+        }
+        else
+        {
+            res.valid_lyts.push_back(std::move(result));
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A ground state simulation for SiDB layouts based on simulated annealing (see simulated_annealing.hpp). Several
+ * annealing instances are run in parallel, each of which starts from a random charge distribution. Moves either change
+ * the charge state of a single SiDB or let a charge hop between two SiDBs. They are evaluated incrementally, i.e., in
+ * \f$ O(n) \f$ time. The minimized cost is the grand potential, i.e., the electrostatic energy plus the energy required
+ * to exchange charges with the bulk, whose minima are physically valid. The physically valid charge distributions that
+ * result from all instances are returned.
+ *
+ * The results are stored in the same format as those of *QuickSim* such that both heuristics can be compared, e.g., via
+ * the time-to-solution metric (see time_to_solution.hpp).
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt The layout to simulate.
+ * @param params Simulation parameters.
+ * @param ps Statistics. They store the simulation results (simulation runtime as well as all physically valid charge
+ * distribution layouts).
+ */
+template <typename Lyt>
+void sidb_simulated_annealing(const Lyt& lyt, const sidb_simulated_annealing_params& params = {},
+                              quicksim_stats<Lyt>* ps = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    quicksim_stats<Lyt> st{};
+
+    detail::sidb_simulated_annealing_impl<Lyt> p{lyt, params, st};
+
+    p.run();
+
+    if (ps)
+    {
+        *ps = st;
+    }
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_SIMULATED_ANNEALING_HPP
@@ -0,0 +1,795 @@
+#ifndef FICTION_SIDB_SIMULATION_CACHE_HPP
+#define FICTION_SIDB_SIMULATION_CACHE_HPP
+
+#include "fiction/algorithms/simulation/sidb/energy_statistics.hpp"
+#include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
+#include "fiction/algorithms/simulation/sidb/quicksim.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
+#include "fiction/layouts/coordinates.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/compact_charge_distribution.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_defects.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
+
+#include <fmt/format.h>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * The positions of all SiDBs of a layout in a canonical form that is independent of the layout's location on the
+ * surface. All positions are translated such that the minimal x-coordinate and the minimal dimer row are `0` and
+ * sorted afterwards. Since the H-Si(100)-2x1 surface is periodic with respect to these translations, layouts with the
+ * same canonical geometry exhibit the same electrostatics.
+ */
+struct canonical_sidb_geometry
+{
+    /**
+     * Translated and sorted SiDB positions.
+     */
+    std::vector<siqad::coord_t> sidbs{};
+    /**
+     * Translation that maps the canonical SiDB positions back to the original ones, i.e., the minimal x-coordinate and
+     * the minimal dimer row of the original layout.
+     */
+    siqad::coord_t offset{0, 0, 0};
+
+    bool operator==(const canonical_sidb_geometry& other) const noexcept
+    {
+        return sidbs == other.sidbs;
+    }
+};
+/**
+ * Determines the canonical geometry of the given SiDB layout.
+ *
+ * @tparam Lyt Cell-level SiDB layout type based on SiQAD coordinates.
+ * @param lyt The layout whose canonical geometry is to be determined.
+ * @return The canonical geometry of `lyt`.
+ */
+template <typename Lyt>
+[[nodiscard]] canonical_sidb_geometry canonicalize_sidb_geometry(const Lyt& lyt) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    canonical_sidb_geometry geometry{};
+    geometry.sidbs.reserve(lyt.num_cells());
+
+    lyt.foreach_cell([&geometry](const auto& c) { geometry.sidbs.push_back(siqad::coord_t{c.x, c.y, c.z}); });
+
+    if (geometry.sidbs.empty())
+    {
+        return geometry;
+    }
+
+    const auto min_x =
+        std::min_element(geometry.sidbs.cbegin(), geometry.sidbs.cend(), [](const auto& lhs, const auto& rhs)
+                         { return lhs.x < rhs.x; })->x;
+    const auto min_y =
+        std::min_element(geometry.sidbs.cbegin(), geometry.sidbs.cend(), [](const auto& lhs, const auto& rhs)
+                         { return lhs.y < rhs.y; })->y;
+
+    for (auto& c : geometry.sidbs)
+    {
+        c.x -= min_x;
+        c.y -= min_y;
+    }
+
+    std::sort(geometry.sidbs.begin(), geometry.sidbs.end());
+
+    geometry.offset = siqad::coord_t{min_x, min_y, 0};
+
+    return geometry;
+}
+/**
+ * Identifies a cached simulation result. Two simulations share a key if they are conducted by the same engine with the
+ * same result-affecting engine parameters and the same physical parameters on layouts with the same canonical geometry.
+ */
+struct sidb_simulation_cache_key
+{
+    /**
+     * Description of the simulation engine including all of its parameters that affect the simulation results.
+     */
+    std::string engine{};
+    /**
+     * Physical simulation parameters.
+     */
+    sidb_simulation_parameters phys_params{};
+    /**
+     * Canonical SiDB positions.
+     */
+    std::vector<siqad::coord_t> sidbs{};
+
+    bool operator==(const sidb_simulation_cache_key& other) const noexcept
+    {
+        return engine == other.engine && phys_params.base == other.phys_params.base &&
+               phys_params.mu == other.phys_params.mu && phys_params.mu_p == other.phys_params.mu_p &&
+               phys_params.epsilon_r == other.phys_params.epsilon_r &&
+               phys_params.lambda_tf == other.phys_params.lambda_tf && phys_params.lat_a == other.phys_params.lat_a &&
+               phys_params.lat_b == other.phys_params.lat_b && phys_params.lat_c == other.phys_params.lat_c &&
+               phys_params.cutoff_radius == other.phys_params.cutoff_radius && sidbs == other.sidbs;
+    }
+};
+
+}  // namespace fiction
+
+namespace std
+{
+
+/**
+ * Provides a hash implementation for `fiction::sidb_simulation_cache_key`.
+ */
+template <>
+struct hash<fiction::sidb_simulation_cache_key>
+{
+    std::size_t operator()(const fiction::sidb_simulation_cache_key& key) const noexcept
+    {
+        std::size_t h = 0;
+        fiction::hash_combine(h, key.engine, key.phys_params.base, key.phys_params.mu, key.phys_params.mu_p,
+                              key.phys_params.epsilon_r, key.phys_params.lambda_tf, key.phys_params.lat_a,
+                              key.phys_params.lat_b, key.phys_params.lat_c, key.phys_params.cutoff_radius);
+
+        for (const auto& c : key.sidbs)
+        {
+            fiction::hash_combine(h, c);
+        }
+
+        return h;
+    }
+};
+
+}  // namespace std
+
+namespace fiction
+{
+
+/**
+ * This struct stores the parameters for the SiDB simulation cache.
+ */
+struct sidb_simulation_cache_params
+{
+    /**
+     * Directory of the on-disk store. If set, each simulation result is additionally stored in a file in this
+     * directory such that it can be reused across program runs. The directory is created if it does not exist.
+     */
+    std::optional<std::filesystem::path> directory{};
+};
+/**
+ * A cache for SiDB simulation results. Results are stored as the charge states of all physically valid charge
+ * distributions in the order of the canonical SiDB positions (see `canonical_sidb_geometry`). Hence, a result that was
+ * determined for one layout can be reused for every translated copy of it, e.g., for each instance of the same gate
+ * tile in a larger layout.
+ *
+ * Results are held in memory and, optionally, in an on-disk store (see `sidb_simulation_cache_params`). Files of the
+ * on-disk store are named by the hash of their key, which is stored in the file as well such that hash collisions are
+ * detected.
+ *
+ * All member functions are thread-safe.
+ */
+class sidb_simulation_cache
+{
+  public:
+    /**
+     * Cached charge distributions.
+     */
+    using result = std::vector<packed_charge_distribution>;
+    /**
+     * Standard constructor.
+     *
+     * @param ps Cache parameters.
+     */
+    explicit sidb_simulation_cache(const sidb_simulation_cache_params& ps = {}) : params{ps}
+    {
+        if (params.directory.has_value())
+        {
+            std::filesystem::create_directories(*params.directory);
+        }
+    }
+    /**
+     * Looks up the result of the given key in memory and, if it is not found there, in the on-disk store.
+     *
+     * @param key Key of the simulation.
+     * @return The cached result or `nullptr` if there is none.
+     */
+    [[nodiscard]] std::shared_ptr<const result> lookup(const sidb_simulation_cache_key& key)
+    {
+        {
+            const std::shared_lock lock{mutex};
+
+            if (const auto it = results.find(key); it != results.cend())
+            {
+                ++num_hits;
+
+                return it->second;
+            }
+        }
+
+        if (auto res = load(key); res != nullptr)
+        {
+            const std::unique_lock lock{mutex};
+
+            ++num_hits;
+
+            return results.emplace(key, std::move(res)).first->second;
+        }
+
+        ++num_misses;
+
+        return nullptr;
+    }
+    /**
+     * Stores the given result in memory and, if configured, in the on-disk store.
+     *
+     * @param key Key of the simulation.
+     * @param res Result of the simulation.
+     */
+    void store(const sidb_simulation_cache_key& key, result res)
+    {
+        auto shared_res = std::make_shared<const result>(std::move(res));
+
+        if (params.directory.has_value())
+        {
+            save(key, *shared_res);
+        }
+
+        const std::unique_lock lock{mutex};
+
+        results.insert_or_assign(key, std::move(shared_res));
+    }
+    /**
+     * Returns the number of results held in memory.
+     *
+     * @return Number of cached results.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::shared_lock lock{mutex};
+
+        return results.size();
+    }
+    /**
+     * Returns the number of successful lookups.
+     *
+     * @return Number of cache hits.
+     */
+    [[nodiscard]] uint64_t hits() const noexcept
+    {
+        return num_hits;
+    }
+    /**
+     * Returns the number of unsuccessful lookups.
+     *
+     * @return Number of cache misses.
+     */
+    [[nodiscard]] uint64_t misses() const noexcept
+    {
+        return num_misses;
+    }
+    /**
+     * Removes all results from memory. The on-disk store is left untouched.
+     */
+    void clear() noexcept
+    {
+        const std::unique_lock lock{mutex};
+
+        results.clear();
+    }
+
+  private:
+    /**
+     * Cache parameters.
+     */
+    const sidb_simulation_cache_params params;
+    /**
+     * Results held in memory.
+     */
+    std::unordered_map<sidb_simulation_cache_key, std::shared_ptr<const result>> results{};
+    /**
+     * Mutex that guards `results`.
+     */
+    mutable std::shared_mutex mutex{};
+    /**
+     * Number of cache hits.
+     */
+    std::atomic<uint64_t> num_hits{0};
+    /**
+     * Number of cache misses.
+     */
+    std::atomic<uint64_t> num_misses{0};
+    /**
+     * Version of the file format of the on-disk store.
+     */
+    static constexpr const char* FILE_HEADER = "fiction-sidb-simulation-cache 2";
+    /**
+     * Returns the path of the file that stores the result of the given key.
+     *
+     * @param key Key of the simulation.
+     * @return Path of the corresponding file in the on-disk store.
+     */
+    [[nodiscard]] std::filesystem::path file_path(const sidb_simulation_cache_key& key) const
+    {
+        return *params.directory / fmt::format("{:016x}.sidbsim", std::hash<sidb_simulation_cache_key>{}(key));
+    }
+    /**
+     * Serializes the given key. Floating-point values are written in hexadecimal notation such that they are restored
+     * exactly.
+     *
+     * @param key Key of the simulation.
+     * @return String representation of `key`.
+     */
+    [[nodiscard]] static std::string serialize_key(const sidb_simulation_cache_key& key)
+    {
+        const auto& p = key.phys_params;
+
+        auto str = fmt::format("{}\n{}\n{} {:a} {:a} {:a} {:a} {:a} {:a} {:a} {:a}\n{}\n", FILE_HEADER, key.engine,
+                               static_cast<uint32_t>(p.base), p.mu, p.mu_p, p.epsilon_r, p.lambda_tf, p.lat_a, p.lat_b,
+                               p.lat_c, p.cutoff_radius, key.sidbs.size());
+
+        for (const auto& c : key.sidbs)
+        {
+            str += fmt::format("{} {} {}\n", c.x, c.y, static_cast<uint32_t>(c.z));
+        }
+
+        return str;
+    }
+    /**
+     * Writes the given result to the on-disk store. The file is written to a temporary location first and moved to its
+     * final location afterwards such that concurrent readers never observe partially written files.
+     *
+     * @param key Key of the simulation.
+     * @param res Result of the simulation.
+     */
+    void save(const sidb_simulation_cache_key& key, const result& res) const
+    {
+        const auto path     = file_path(key);
+        const auto tmp_path = std::filesystem::path{path}.concat(
+            fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id())));
+
+        {
+            std::ofstream file{tmp_path, std::ios::trunc};
+
+            if (!file.is_open())
+            {
+                return;
+            }
+
+            file << serialize_key(key) << res.size() << '\n';
+
+            for (const auto& charges : res)
+            {
+                for (uint64_t i = 0; i < charges.size(); ++i)
+                {
+                    file << to_char(charges.get_charge_state(i));
+                }
+
+                file << '\n';
+            }
+        }
+
+        std::error_code ec{};
+        std::filesystem::rename(tmp_path, path, ec);
+    }
+    /**
+     * Reads the result of the given key from the on-disk store.
+     *
+     * @param key Key of the simulation.
+     * @return The stored result or `nullptr` if there is none or if the file belongs to a different key.
+     */
+    [[nodiscard]] std::shared_ptr<const result> load(const sidb_simulation_cache_key& key) const
+    {
+        if (!params.directory.has_value())
+        {
+            return nullptr;
+        }
+
+        std::ifstream file{file_path(key)};
+
+        if (!file.is_open())
+        {
+            return nullptr;
+        }
+
+        const auto expected_key = serialize_key(key);
+
+        std::string stored_key(expected_key.size(), '\0');
+        file.read(stored_key.data(), static_cast<std::streamsize>(stored_key.size()));
+
+        // hash collision or a file of a different format version
+        if (!file || stored_key != expected_key)
+        {
+            return nullptr;
+        }
+
+        std::size_t num_results = 0;
+        file >> num_results;
+
+        result res{};
+        res.reserve(num_results);
+
+        for (std::size_t r = 0; r < num_results; ++r)
+        {
+            std::string line{};
+            file >> line;
+
+            if (!file || line.size() != key.sidbs.size())
+            {
+                return nullptr;
+            }
+
+            std::vector<sidb_charge_state> charge_states(line.size());
+            std::transform(line.cbegin(), line.cend(), charge_states.begin(), from_char);
+
+            res.emplace_back(charge_states);
+        }
+
+        return std::make_shared<const result>(std::move(res));
+    }
+
+    [[nodiscard]] static char to_char(const sidb_charge_state cs) noexcept
+    {
+        switch (cs)
+        {
+            case sidb_charge_state::NEGATIVE:
+            {
+                return '-';
+            }
+            case sidb_charge_state::POSITIVE:
+            {
+                return '+';
+            }
+            default:
+            {
+                return '0';
+            }
+        }
+    }
+
+    [[nodiscard]] static sidb_charge_state from_char(const char c) noexcept
+    {
+        switch (c)
+        {
+            case '-':
+            {
+                return sidb_charge_state::NEGATIVE;
+            }
+            case '+':
+            {
+                return sidb_charge_state::POSITIVE;
+            }
+            default:
+            {
+                return sidb_charge_state::NEUTRAL;
+            }
+        }
+    }
+};
+
+namespace detail
+{
+
+/**
+ * Extracts the charge states of the given charge distributions in the order of the canonical SiDB positions.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @param charge_lyts Charge distributions to extract.
+ * @param compact_charge_lyts Compactly stored charge distributions to extract.
+ * @param geometry Canonical geometry of the simulated layout.
+ * @return The charge states of all charge distributions.
+ */
+template <typename Lyt>
+sidb_simulation_cache::result to_cached_result(const std::vector<charge_distribution_surface<Lyt>>& charge_lyts,
+                                               const compact_charge_distributions<Lyt>& compact_charge_lyts,
+                                               const canonical_sidb_geometry&           geometry)
+{
+    sidb_simulation_cache::result res{};
+    res.reserve(charge_lyts.size() + compact_charge_lyts.size());
+
+    const auto extract = [&res, &geometry](const charge_distribution_surface<Lyt>& charge_lyt)
+    {
+        packed_charge_distribution charges{std::vector<sidb_charge_state>(geometry.sidbs.size())};
+
+        for (uint64_t i = 0; i < geometry.sidbs.size(); ++i)
+        {
+            const auto& c = geometry.sidbs[i];
+
+            charges.assign_charge_state(i, charge_lyt.get_charge_state(typename Lyt::cell{
+                                               c.x + geometry.offset.x, c.y + geometry.offset.y, c.z}));
+        }
+
+        res.push_back(std::move(charges));
+    };
+
+    std::for_each(charge_lyts.cbegin(), charge_lyts.cend(), extract);
+
+    for (std::size_t i = 0; i < compact_charge_lyts.size(); ++i)
+    {
+        extract(compact_charge_lyts.materialize(i));
+    }
+
+    return res;
+}
+/**
+ * Restores cached charge distributions for the given layout, stores them in the given statistics, and accumulates their
+ * energy statistics.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @tparam Stats Statistics type, i.e., `exgs_stats<Lyt>` or `quicksim_stats<Lyt>`.
+ * @param lyt The simulated layout.
+ * @param phys_params Physical simulation parameters.
+ * @param geometry Canonical geometry of `lyt`.
+ * @param res Cached result.
+ * @param compact_results Flag to indicate that the charge distributions are to be stored compactly.
+ * @param retain_valid_lyts Flag to indicate that the charge distributions are to be stored at all.
+ * @param num_lowest_energy_states Number of charge distributions to retain in the energy statistics.
+ * @param st Statistics to store the charge distributions in.
+ */
+template <typename Lyt, typename Stats>
+void restore_cached_result(const Lyt& lyt, const sidb_simulation_parameters& phys_params,
+                           const canonical_sidb_geometry& geometry, const sidb_simulation_cache::result& res,
+                           const bool compact_results, const bool retain_valid_lyts,
+                           const uint64_t num_lowest_energy_states, Stats& st)
+{
+    const charge_distribution_surface<Lyt> model{lyt, phys_params, sidb_charge_state::NEGATIVE};
+
+    // maps the canonical SiDB positions to the indices of the charge distribution surface
+    std::vector<uint64_t> indices(geometry.sidbs.size());
+    std::transform(geometry.sidbs.cbegin(), geometry.sidbs.cend(), indices.begin(),
+                   [&model, &geometry](const auto& c)
+                   {
+                       return static_cast<uint64_t>(model.cell_to_index(
+                           typename Lyt::cell{c.x + geometry.offset.x, c.y + geometry.offset.y, c.z}));
+                   });
+
+    if (compact_results)
+    {
+        st.compact_valid_lyts =
+            compact_charge_distributions<Lyt>{std::make_shared<const charge_distribution_surface<Lyt>>(model)};
+    }
+
+    st.energy_statistics = sidb_energy_statistics<Lyt>{num_lowest_energy_states};
+
+    for (const auto& charges : res)
+    {
+        charge_distribution_surface<Lyt> charge_lyt{model};
+
+        for (uint64_t i = 0; i < charges.size(); ++i)
+        {
+            charge_lyt.assign_charge_state_by_cell_index(indices[i], charges.get_charge_state(i), false);
+        }
+
+        charge_lyt.update_after_charge_change();
+        charge_lyt.charge_distribution_to_index();
+
+        st.energy_statistics.add(charge_lyt);
+
+        if (!retain_valid_lyts)
+        {
+            continue;
+        }
+
+        if (compact_results)
+        {
+            st.compact_valid_lyts.add(charge_lyt);
+        }
+        else
+        {
+            st.valid_lyts.push_back(std::move(charge_lyt));
+        }
+    }
+}
+
+/**
+ * Checks whether the given layout contains charged defects. Since they affect the simulation result but are not part
+ * of the canonical geometry, such layouts are not cached.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @param lyt The layout to check.
+ * @return `true` iff `lyt` provides SiDB defects and at least one of them is charged.
+ */
+template <typename Lyt>
+[[nodiscard]] bool has_charged_defects([[maybe_unused]] const Lyt& lyt) noexcept
+{
+    if constexpr (has_foreach_sidb_defect_v<Lyt>)
+    {
+        bool charged = false;
+
+        lyt.foreach_sidb_defect([&charged](const auto& cd) { charged = charged || is_charged_defect(cd.second); });
+
+        return charged;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+/**
+ * Invokes the given callback with the charge distribution of minimum energy out of the restored ones, as if it were
+ * the only new minimum that *QuickSim* found.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @tparam Callback Type of `quicksim_params::new_minimum_callback`.
+ * @param st Statistics that hold the restored charge distributions.
+ * @param callback Callback to invoke.
+ */
+template <typename Lyt, typename Callback>
+void report_cached_minimum(const quicksim_stats<Lyt>& st, const Callback& callback)
+{
+    if (!st.compact_valid_lyts.empty())
+    {
+        const auto minimum = std::min_element(st.compact_valid_lyts.begin(), st.compact_valid_lyts.end(),
+                                              [](const auto& a, const auto& b)
+                                              { return a.system_energy < b.system_energy; });
+
+        callback(minimum->charges.get_all_charge_states(), minimum->system_energy);
+    }
+    else if (!st.valid_lyts.empty())
+    {
+        const auto minimum = std::min_element(st.valid_lyts.cbegin(), st.valid_lyts.cend(),
+                                              [](const auto& a, const auto& b)
+                                              { return a.get_system_energy() < b.get_system_energy(); });
+
+        callback(minimum->get_all_sidb_charges(), minimum->get_system_energy());
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Exhaustive ground state simulation (see exhaustive_ground_state_simulation.hpp) whose results are memoized in the
+ * given cache. If the cache holds a result for a layout with the same canonical geometry and the same physical
+ * parameters, the simulation is skipped and the cached charge distributions are restored for `lyt` instead. Layouts
+ * with charged defects are simulated without the cache.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Parameters of the exhaustive ground state simulation.
+ * @param cache Cache of simulation results.
+ * @param pst Statistics. If the result is taken from the cache, `time_total` refers to the time required to restore it.
+ */
+template <typename Lyt>
+void cached_exhaustive_ground_state_simulation(const Lyt& lyt, const exgs_params& ps, sidb_simulation_cache& cache,
+                                               exgs_stats<Lyt>* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    if (detail::has_charged_defects(lyt))
+    {
+        exhaustive_ground_state_simulation(lyt, ps, pst);
+
+        return;
+    }
+
+    exgs_stats<Lyt> st{};
+
+    auto geometry = canonicalize_sidb_geometry(lyt);
+
+    // all enumeration orders and thread counts yield the same set of charge distributions
+    sidb_simulation_cache_key key{"exgs", ps.phys_params, std::move(geometry.sidbs)};
+
+    if (const auto res = cache.lookup(key); res != nullptr)
+    {
+        mockturtle::stopwatch stop{st.time_total};
+
+        geometry.sidbs = std::move(key.sidbs);
+        detail::restore_cached_result(lyt, ps.phys_params, geometry, *res, ps.compact_results, ps.retain_valid_lyts,
+                                      ps.num_lowest_energy_states, st);
+    }
+    else
+    {
+        // the charge distributions have to be retained to be cached
+        auto retaining_ps              = ps;
+        retaining_ps.retain_valid_lyts = true;
+
+        exhaustive_ground_state_simulation(lyt, retaining_ps, &st);
+
+        geometry.sidbs = key.sidbs;
+        cache.store(key, detail::to_cached_result(st.valid_lyts, st.compact_valid_lyts, geometry));
+
+        if (!ps.retain_valid_lyts)
+        {
+            st.valid_lyts.clear();
+            st.compact_valid_lyts = compact_charge_distributions<Lyt>{};
+        }
+    }
+
+    if (pst)
+    {
+        *pst = st;
+    }
+}
+/**
+ * *QuickSim* (see quicksim.hpp) whose results are memoized in the given cache. If the cache holds a result for a
+ * layout with the same canonical geometry, the same physical parameters, and the same *QuickSim* parameters that affect
+ * the result, the simulation is skipped and the cached charge distributions are restored for `lyt` instead. In this
+ * case, `quicksim_params::new_minimum_callback` is invoked once with the restored charge distribution of minimum
+ * energy. Since only seeded simulations are reproducible, unseeded ones (see `quicksim_params::seed`) are carried out
+ * without the cache. Results of simulations that were terminated early (see `quicksim_stats::terminated_early`) and
+ * layouts with charged defects are not cached either.
+ *
+ * @tparam Lyt Cell-level SiDB layout type.
+ * @param lyt The layout to simulate.
+ * @param ps Parameters of *QuickSim*.
+ * @param cache Cache of simulation results.
+ * @param pst Statistics. If the result is taken from the cache, `time_total` refers to the time required to restore it.
+ */
+template <typename Lyt>
+void cached_quicksim(const Lyt& lyt, const quicksim_params& ps, sidb_simulation_cache& cache,
+                     quicksim_stats<Lyt>* pst = nullptr)
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    if (!ps.seed.has_value() || detail::has_charged_defects(lyt))
+    {
+        quicksim(lyt, ps, pst);
+
+        return;
+    }
+
+    quicksim_stats<Lyt> st{};
+
+    auto geometry = canonicalize_sidb_geometry(lyt);
+
+    sidb_simulation_cache_key key{
+        fmt::format("quicksim {} {:a} {} {} {}", ps.interation_steps, ps.alpha, *ps.seed, ps.number_threads,
+                    ps.single_precision ? "single" : "double"),
+        ps.phys_params, std::move(geometry.sidbs)};
+
+    if (const auto res = cache.lookup(key); res != nullptr)
+    {
+        mockturtle::stopwatch stop{st.time_total};
+
+        geometry.sidbs = std::move(key.sidbs);
+        detail::restore_cached_result(lyt, ps.phys_params, geometry, *res, ps.compact_results, true,
+                                      ps.num_lowest_energy_states, st);
+
+        if (ps.new_minimum_callback)
+        {
+            detail::report_cached_minimum(st, ps.new_minimum_callback);
+        }
+    }
+    else
+    {
+        quicksim(lyt, ps, &st);
+
+        if (!st.terminated_early)
+        {
+            geometry.sidbs = key.sidbs;
+            cache.store(key, detail::to_cached_result(st.valid_lyts, st.compact_valid_lyts, geometry));
+        }
+    }
+
+    if (pst)
+    {
+        *pst = st;
+    }
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_SIMULATION_CACHE_HPP
@@ -88,6 +88,13 @@ struct sidb_simulation_parameters
      * It often makes sense to assume only negatively and neutrally charged SiDBs.
      */
     uint8_t base;
+    /**
+     * cutoff_radius is the distance (unit: m) beyond which SiDBs are assumed not to interact. Since the screened
+     * Coulomb potential decays exponentially with lambda_tf, it can be neglected for distant SiDBs. If it is larger
+     * than 0, only the potentials between SiDBs within this radius are stored (see `charge_distribution_surface`),
+     * which makes large layouts, e.g., entire circuits, tractable. The default value 0 disables the cutoff.
+     */
+    double cutoff_radius{0.0};
 };
 
 }  // namespace fiction
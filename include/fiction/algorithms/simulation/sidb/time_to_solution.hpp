@@ -5,20 +5,30 @@
 #ifndef FICTION_TIME_TO_SOLUTION_HPP
 #define FICTION_TIME_TO_SOLUTION_HPP
 
+#include "fiction/algorithms/simulation/sidb/branch_and_bound_ground_state_simulation.hpp"
 #include "fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp"
 #include "fiction/algorithms/simulation/sidb/is_ground_state.hpp"
 #include "fiction/algorithms/simulation/sidb/minimum_energy.hpp"
 #include "fiction/algorithms/simulation/sidb/quicksim.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulated_annealing.hpp"
+#include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/technology/charge_distribution_surface.hpp"
 #include "fiction/traits.hpp"
 
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -48,6 +58,19 @@ struct time_to_solution_stats
      * Single simulation runtime of the exhaustive ground state searcher.
      */
     double single_runtime_exhaustive{};
+    /**
+     * Number of repetitions that were actually performed. It is smaller than the requested number of repetitions if
+     * the measurement stopped early (see `time_to_solution_params::max_interval_width`).
+     */
+    uint64_t repetitions{};
+    /**
+     * Lower bound of the Wilson score interval of the accuracy (in percent).
+     */
+    double acc_lower{};
+    /**
+     * Upper bound of the Wilson score interval of the accuracy (in percent).
+     */
+    double acc_upper{};
 
     /**
      * Print the results to the given output stream.
@@ -56,61 +79,249 @@ struct time_to_solution_stats
      */
     void report(std::ostream& out = std::cout)
     {
-        out << fmt::format("time_to_solution: {} | acc: {} | t_(s): {} | t_exhaustive(s): {}\n", time_to_solution, acc,
-                           mean_single_runtime, single_runtime_exhaustive);
+        out << fmt::format("time_to_solution: {} | acc: {} [{}, {}] | t_(s): {} | t_exhaustive(s): {} | "
+                           "repetitions: {}\n",
+                           time_to_solution, acc, acc_lower, acc_upper, mean_single_runtime, single_runtime_exhaustive,
+                           repetitions);
     }
 };
 /**
- * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm.
+ * Exact simulation engines that can be used to determine the reference ground state.
+ */
+enum class exhaustive_sidb_simulation_engine
+{
+    /**
+     * Exhaustive ground state simulation (see exhaustive_ground_state_simulation.hpp).
+     */
+    EXGS,
+    /**
+     * Branch-and-bound ground state simulation (see branch_and_bound_ground_state_simulation.hpp).
+     */
+    BRANCH_AND_BOUND
+};
+/**
+ * This struct stores the parameters for the time-to-solution determination.
+ */
+struct time_to_solution_params
+{
+    /**
+     * Exact simulation engine that determines the reference ground state.
+     */
+    exhaustive_sidb_simulation_engine engine{exhaustive_sidb_simulation_engine::EXGS};
+    /**
+     * Number of repetitions to determine the simulation accuracy (`repetitions = 100` means that accuracy is precise to
+     * 1%).
+     */
+    uint64_t repetitions{100};
+    /**
+     * The time-to-solution also depends on the given confidence level which can be set here.
+     */
+    double confidence_level{0.997};
+    /**
+     * Total number of threads that may be used. The exhaustive reference simulation uses all of them. Repetitions are
+     * run concurrently, each using as many threads as specified in the parameters of the heuristic. Hence,
+     * `number_threads / heuristic threads` repetitions run at the same time. Note that concurrent repetitions compete
+     * for resources, which may increase their measured runtimes.
+     */
+    uint64_t number_threads{1};
+    /**
+     * Confidence level of the Wilson score interval of the accuracy.
+     */
+    double interval_confidence_level{0.95};
+    /**
+     * If larger than 0, the measurement stops as soon as the Wilson score interval of the accuracy (as a fraction in
+     * \f$ [0, 1] \f$) is at most this wide, even if fewer than `repetitions` repetitions were performed.
+     */
+    double max_interval_width{0.0};
+};
+namespace detail
+{
+
+/**
+ * Computes the quantile of the standard normal distribution that corresponds to the given two-sided confidence level,
+ * e.g., approximately 1.96 for a confidence level of 0.95.
+ *
+ * @param confidence_level Two-sided confidence level in \f$ (0, 1) \f$.
+ * @return Quantile \f$ z \f$ such that \f$ P(|X| \leq z) = \f$ `confidence_level` for standard normal \f$ X \f$.
+ */
+[[nodiscard]] inline double normal_quantile(const double confidence_level) noexcept
+{
+    assert(confidence_level > 0.0 && confidence_level < 1.0 && "the confidence level has to be in (0, 1)");
+
+    // P(|X| <= z) = 1 - erfc(z / sqrt(2)) is monotonically increasing in z; hence, it is inverted by bisection
+    double lower = 0.0;
+    double upper = 40.0;
+
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        const auto mid = (lower + upper) / 2;
+
+        if (1.0 - std::erfc(mid / std::sqrt(2.0)) < confidence_level)
+        {
+            lower = mid;
+        }
+        else
+        {
+            upper = mid;
+        }
+    }
+
+    return (lower + upper) / 2;
+}
+/**
+ * Computes the Wilson score interval of a success probability. In contrast to the normal approximation, it remains
+ * meaningful for few trials and for success rates close to 0 or 1.
+ *
+ * @param successes Number of successful trials.
+ * @param trials Number of trials. Must not be 0.
+ * @param z Quantile of the standard normal distribution that corresponds to the confidence level.
+ * @return Lower and upper bound of the interval.
+ */
+[[nodiscard]] inline std::pair<double, double> wilson_interval(const uint64_t successes, const uint64_t trials,
+                                                               const double z) noexcept
+{
+    assert(trials > 0 && "the interval requires at least one trial");
+
+    const auto n     = static_cast<double>(trials);
+    const auto p     = static_cast<double>(successes) / n;
+    const auto z2    = z * z;
+    const auto denom = 1.0 + z2 / n;
+
+    const auto center = (p + z2 / (2.0 * n)) / denom;
+    const auto half   = z / denom * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n));
+
+    return {std::max(center - half, 0.0), std::min(center + half, 1.0)};
+}
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of a heuristic SiDB simulation algorithm
+ * whose results are stored in `quicksim_stats`.
  *
  * @tparam Lyt Cell-level layout type.
+ * @tparam HeuristicFn Callable that simulates `lyt` and stores its results in the given `quicksim_stats<Lyt>`. It
+ * additionally receives the index of the repetition, e.g., to derive a distinct seed for each repetition.
  * @param lyt Layout that is used for the simulation.
- * @param sidb_params Physical SiDB parameters which are used for the simulation.
+ * @param phys_params Physical SiDB parameters that are used to determine the reference ground state.
+ * @param tts_params Parameters of the time-to-solution determination.
+ * @param heuristic The heuristic simulation algorithm.
+ * @param heuristic_threads Number of threads that a single run of `heuristic` uses.
  * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
- * @param repetitions Number of repetitions to determine the simulation accuracy (`repetitions = 100` means that
- * accuracy is precise to 1%).
- * @param confidence_level The time-to-solution also depends on the given confidence level which can be set here.
  */
-template <typename Lyt>
-void sim_acc_tts(const Lyt& lyt, const quicksim_params& quicksim_params, time_to_solution_stats* ps = nullptr,
-                 const uint64_t& repetitions = 100, const double confidence_level = 0.997) noexcept
+template <typename Lyt, typename HeuristicFn>
+void sim_acc_tts(const Lyt& lyt, const sidb_simulation_parameters& phys_params,
+                 const time_to_solution_params& tts_params, HeuristicFn&& heuristic, const uint64_t heuristic_threads,
+                 time_to_solution_stats* ps = nullptr) noexcept
 {
-    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
-    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
-    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
-
     exgs_stats<Lyt> stats_exhaustive{};
-    exhaustive_ground_state_simulation(lyt, quicksim_params.phys_params, &stats_exhaustive);
+
+    switch (tts_params.engine)
+    {
+        case exhaustive_sidb_simulation_engine::EXGS:
+        {
+            // only the ground state energy is required as a reference
+            exgs_params exgs_ps{phys_params};
+            exgs_ps.number_threads    = tts_params.number_threads;
+            exgs_ps.retain_valid_lyts = false;
+
+            exhaustive_ground_state_simulation(lyt, exgs_ps, &stats_exhaustive);
+
+            break;
+        }
+        case exhaustive_sidb_simulation_engine::BRANCH_AND_BOUND:
+        {
+            branch_and_bound_ground_state_simulation(lyt, phys_params, &stats_exhaustive);
+
+            break;
+        }
+    }
 
     time_to_solution_stats st{};
     st.single_runtime_exhaustive = mockturtle::to_seconds(stats_exhaustive.time_total);
 
-    std::size_t         gs_count = 0;
+    const auto repetitions      = tts_params.repetitions;
+    const auto confidence_level = tts_params.confidence_level;
+
+    const auto z = normal_quantile(tts_params.interval_confidence_level);
+
+    uint64_t            gs_count = 0;
     std::vector<double> time{};
     time.reserve(repetitions);
 
-    for (uint64_t i = 0; i < repetitions; i++)
+    std::mutex            mutex{};
+    std::atomic<uint64_t> next_repetition{0};
+    std::atomic<bool>     stop{false};
+
+    const auto run_repetitions = [&]
     {
-        quicksim_stats<Lyt> stats_quick{};
+        while (!stop.load())
+        {
+            const auto repetition = next_repetition.fetch_add(1);
+
+            if (repetition >= repetitions)
+            {
+                break;
+            }
+
+            quicksim_stats<Lyt> stats_heuristic{};
+
+            const auto t_start = std::chrono::high_resolution_clock::now();
+
+            heuristic(stats_heuristic, repetition);
+
+            const auto t_end      = std::chrono::high_resolution_clock::now();
+            const auto elapsed    = t_end - t_start;
+            const auto diff_first = std::chrono::duration<double>(elapsed).count();
 
-        const auto t_start = std::chrono::high_resolution_clock::now();
+            const auto found_ground_state = is_ground_state(stats_heuristic, stats_exhaustive);
 
-        quicksim<Lyt>(lyt, quicksim_params, &stats_quick);
+            const std::lock_guard lock{mutex};
 
-        const auto t_end      = std::chrono::high_resolution_clock::now();
-        const auto elapsed    = t_end - t_start;
-        const auto diff_first = std::chrono::duration<double>(elapsed).count();
+            time.push_back(diff_first);
 
-        time.push_back(diff_first);
+            if (found_ground_state)
+            {
+                gs_count += 1;
+            }
+
+            if (tts_params.max_interval_width > 0.0)
+            {
+                const auto [lower, upper] = wilson_interval(gs_count, time.size(), z);
+
+                if (upper - lower <= tts_params.max_interval_width)
+                {
+                    stop.store(true);
+                }
+            }
+        }
+    };
+
+    // as many repetitions run concurrently as the thread budget allows
+    const auto num_concurrent = std::min(
+        std::max(tts_params.number_threads / std::max(heuristic_threads, uint64_t{1}), uint64_t{1}), repetitions);
+
+    if (num_concurrent <= 1)
+    {
+        run_repetitions();
+    }
+    else
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(num_concurrent);
 
-        if (is_ground_state(stats_quick, stats_exhaustive))
+        for (uint64_t t = 0; t < num_concurrent; ++t)
         {
-            gs_count += 1;
+            threads.emplace_back(run_repetitions);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
         }
     }
 
-    const auto single_runtime = std::accumulate(time.begin(), time.end(), 0.0) / static_cast<double>(repetitions);
-    const auto acc            = static_cast<double>(gs_count) / static_cast<double>(repetitions);
+    const auto performed = std::max(time.size(), std::size_t{1});
+
+    const auto single_runtime = std::accumulate(time.begin(), time.end(), 0.0) / static_cast<double>(performed);
+    const auto acc            = static_cast<double>(gs_count) / static_cast<double>(performed);
 
     double tts = single_runtime;
 
@@ -130,6 +341,15 @@ void sim_acc_tts(const Lyt& lyt, const quicksim_params& quicksim_params, time_to
     st.time_to_solution    = tts;
     st.acc                 = acc * 100;
     st.mean_single_runtime = single_runtime;
+    st.repetitions         = time.size();
+
+    if (!time.empty())
+    {
+        const auto [lower, upper] = wilson_interval(gs_count, time.size(), z);
+
+        st.acc_lower = lower * 100;
+        st.acc_upper = upper * 100;
+    }
 
     if (ps)
     {
@@ -137,6 +357,103 @@ void sim_acc_tts(const Lyt& lyt, const quicksim_params& quicksim_params, time_to
     }
 }
 
+}  // namespace detail
+
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm. If
+ * `quicksim_params.seed` is set, repetition `i` is seeded with `seed + i` such that the repetitions are independent of
+ * each other while the accuracy remains reproducible.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt Layout that is used for the simulation.
+ * @param quicksim_params Parameters of *QuickSim*, including the physical SiDB parameters.
+ * @param tts_params Parameters of the time-to-solution determination.
+ * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
+ */
+template <typename Lyt>
+void sim_acc_tts(const Lyt& lyt, const quicksim_params& quicksim_params, const time_to_solution_params& tts_params,
+                 time_to_solution_stats* ps = nullptr) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    detail::sim_acc_tts(
+        lyt, quicksim_params.phys_params, tts_params,
+        [&lyt, &quicksim_params](quicksim_stats<Lyt>& stats, const uint64_t repetition)
+        {
+            if (quicksim_params.seed.has_value())
+            {
+                auto repetition_params = quicksim_params;
+                repetition_params.seed = *quicksim_params.seed + repetition;
+
+                quicksim<Lyt>(lyt, repetition_params, &stats);
+            }
+            else
+            {
+                quicksim<Lyt>(lyt, quicksim_params, &stats);
+            }
+        },
+        quicksim_params.number_threads, ps);
+}
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the simulated annealing-based ground
+ * state simulation (see sidb_simulated_annealing.hpp). Since it stores its results in the same format as *QuickSim*,
+ * the TTS of both heuristics can be compared directly. As for *QuickSim*, repetition `i` is seeded with `seed + i` if
+ * `annealing_params.seed` is set.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt Layout that is used for the simulation.
+ * @param annealing_params Parameters of the simulated annealing, including the physical SiDB parameters.
+ * @param tts_params Parameters of the time-to-solution determination.
+ * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
+ */
+template <typename Lyt>
+void sim_acc_tts(const Lyt& lyt, const sidb_simulated_annealing_params& annealing_params,
+                 const time_to_solution_params& tts_params, time_to_solution_stats* ps = nullptr) noexcept
+{
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+    static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+
+    detail::sim_acc_tts(
+        lyt, annealing_params.phys_params, tts_params,
+        [&lyt, &annealing_params](quicksim_stats<Lyt>& stats, const uint64_t repetition)
+        {
+            if (annealing_params.seed.has_value())
+            {
+                auto repetition_params = annealing_params;
+                repetition_params.seed = *annealing_params.seed + repetition;
+
+                sidb_simulated_annealing<Lyt>(lyt, repetition_params, &stats);
+            }
+            else
+            {
+                sidb_simulated_annealing<Lyt>(lyt, annealing_params, &stats);
+            }
+        },
+        annealing_params.number_threads, ps);
+}
+/**
+ * This function determines the time-to-solution (TTS) and the accuracy (acc) of the *QuickSim* algorithm. The ground
+ * state is determined by the exhaustive ground state simulation.
+ *
+ * @tparam Lyt Cell-level layout type.
+ * @param lyt Layout that is used for the simulation.
+ * @param quicksim_params Parameters of *QuickSim*, including the physical SiDB parameters.
+ * @param ps Pointer to a struct where the results (time_to_solution, acc, single runtime) are stored.
+ * @param repetitions Number of repetitions to determine the simulation accuracy (`repetitions = 100` means that
+ * accuracy is precise to 1%).
+ * @param confidence_level The time-to-solution also depends on the given confidence level which can be set here.
+ */
+template <typename Lyt>
+void sim_acc_tts(const Lyt& lyt, const quicksim_params& quicksim_params, time_to_solution_stats* ps = nullptr,
+                 const uint64_t& repetitions = 100, const double confidence_level = 0.997) noexcept
+{
+    sim_acc_tts(lyt, quicksim_params,
+                time_to_solution_params{exhaustive_sidb_simulation_engine::EXGS, repetitions, confidence_level}, ps);
+}
+
 }  // namespace fiction
 
 #endif  // FICTION_TIME_TO_SOLUTION_HPP
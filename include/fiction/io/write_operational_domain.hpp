@@ -0,0 +1,88 @@
+#ifndef FICTION_WRITE_OPERATIONAL_DOMAIN_HPP
+#define FICTION_WRITE_OPERATIONAL_DOMAIN_HPP
+
+#include "fiction/algorithms/simulation/sidb/operational_domain.hpp"
+#include "fiction/io/csv_writer.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <ostream>
+#include <string_view>
+
+namespace fiction
+{
+
+/**
+ * Writes the operational domain of an SiDB gate to a CSV file. The first line names the columns `mu`, `epsilon_r`,
+ * `lambda_tf` (unit: nm), and `operational`, each subsequent line represents one grid point. An existing file is
+ * overwritten.
+ *
+ * @param domain The operational domain to be written.
+ * @param filename The file name to create and write into. Should preferably use the `.csv` extension.
+ */
+inline void write_operational_domain_csv(const operational_domain& domain, const std::string_view& filename)
+{
+    // csv_writer appends to existing files
+    if (std::ofstream file{filename.data(), std::ofstream::out | std::ofstream::trunc}; !file.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    csv_writer writer{filename};
+
+    writer.write_line("mu", "epsilon_r", "lambda_tf", "operational");
+
+    for (const auto& p : domain.points)
+    {
+        writer.write_line(p.mu, p.epsilon_r, p.lambda_tf * 1E9, p.operational ? 1 : 0);
+    }
+}
+/**
+ * Writes the operational domain of an SiDB gate in the JSON format, i.e., as an array of objects with the members
+ * `mu`, `epsilon_r`, `lambda_tf` (unit: nm), and `operational`, each of which represents one grid point.
+ *
+ * This overload uses an output stream to write into.
+ *
+ * @param domain The operational domain to be written.
+ * @param os The output stream to write into.
+ */
+inline void write_operational_domain_json(const operational_domain& domain, std::ostream& os)
+{
+    nlohmann::json points = nlohmann::json::array();
+
+    for (const auto& p : domain.points)
+    {
+        points.push_back({{"mu", p.mu},
+                          {"epsilon_r", p.epsilon_r},
+                          {"lambda_tf", p.lambda_tf * 1E9},
+                          {"operational", p.operational}});
+    }
+
+    os << points.dump(4) << std::endl;
+}
+/**
+ * Writes the operational domain of an SiDB gate in the JSON format, i.e., as an array of objects with the members
+ * `mu`, `epsilon_r`, `lambda_tf` (unit: nm), and `operational`, each of which represents one grid point.
+ *
+ * This overload uses file name to create and write into.
+ *
+ * @param domain The operational domain to be written.
+ * @param filename The file name to create and write into. Should preferably use the `.json` extension.
+ */
+inline void write_operational_domain_json(const operational_domain& domain, const std::string_view& filename)
+{
+    std::ofstream os{filename.data(), std::ofstream::out};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_operational_domain_json(domain, os);
+    os.close();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_WRITE_OPERATIONAL_DOMAIN_HPP
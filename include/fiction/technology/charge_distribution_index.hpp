@@ -0,0 +1,335 @@
+#ifndef FICTION_CHARGE_DISTRIBUTION_INDEX_HPP
+#define FICTION_CHARGE_DISTRIBUTION_INDEX_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * An unsigned integer of arbitrary width that represents the index of a charge distribution of an SiDB layout, i.e.,
+ * the charge states of all SiDBs interpreted as the digits of a number in the simulation base (see
+ * `charge_distribution_surface::charge_distribution_to_index`). Since there are \f$ 2^n \f$ or \f$ 3^n \f$ charge
+ * distributions of \f$ n \f$ SiDBs, indices of layouts with more than 64 SiDBs in base 2 or 40 SiDBs in base 3 do not
+ * fit into 64 bits. Therefore, the index is stored in as many 64-bit words as required and all arithmetic is exact.
+ *
+ * Only the operations that are required to compute, enumerate, and partition charge distribution indices are provided.
+ * Multiplications and divisions are restricted to 32-bit factors and divisors, which suffice for the simulation base,
+ * such that they can be carried out portably without 128-bit intermediate results.
+ */
+class charge_distribution_index
+{
+  public:
+    /**
+     * Standard constructor. Creates the index `0`.
+     */
+    charge_distribution_index() = default;
+    /**
+     * Creates an index from a 64-bit value. The constructor is not explicit such that indices can be compared with and
+     * assigned from integers.
+     *
+     * @param value Value of the index.
+     */
+    charge_distribution_index(const uint64_t value) noexcept  // NOLINT(google-explicit-constructor)
+    {
+        if (value != 0)
+        {
+            words.push_back(value);
+        }
+    }
+    /**
+     * Computes `base` to the power of `exponent` exactly.
+     *
+     * @param base Base.
+     * @param exponent Exponent.
+     * @return `base` to the power of `exponent`.
+     */
+    [[nodiscard]] static charge_distribution_index power(const uint32_t base, const uint64_t exponent) noexcept
+    {
+        charge_distribution_index result{1};
+
+        for (uint64_t i = 0; i < exponent; ++i)
+        {
+            result *= base;
+        }
+
+        return result;
+    }
+    /**
+     * Adds a 64-bit value.
+     *
+     * @param value Value to add.
+     * @return Reference to this index.
+     */
+    charge_distribution_index& operator+=(const uint64_t value) noexcept
+    {
+        auto carry = value;
+
+        for (auto& word : words)
+        {
+            if (carry == 0)
+            {
+                return *this;
+            }
+
+            word += carry;
+            carry = word < carry ? 1 : 0;
+        }
+
+        if (carry != 0)
+        {
+            words.push_back(carry);
+        }
+
+        return *this;
+    }
+    /**
+     * Subtracts a 64-bit value, which must not be larger than the index.
+     *
+     * @param value Value to subtract.
+     * @return Reference to this index.
+     */
+    charge_distribution_index& operator-=(const uint64_t value) noexcept
+    {
+        assert(!(*this < charge_distribution_index{value}) && "The charge distribution index must not be negative.");
+
+        auto borrow = value;
+
+        for (auto& word : words)
+        {
+            if (borrow == 0)
+            {
+                break;
+            }
+
+            const auto previous = word;
+
+            word -= borrow;
+            borrow = word > previous ? 1 : 0;
+        }
+
+        normalize();
+
+        return *this;
+    }
+    /**
+     * Multiplies the index by a 32-bit factor.
+     *
+     * @param factor Factor.
+     * @return Reference to this index.
+     */
+    charge_distribution_index& operator*=(const uint32_t factor) noexcept
+    {
+        uint64_t carry = 0;
+
+        // each word is multiplied as two 32-bit halves such that no intermediate result exceeds 64 bits
+        for (auto& word : words)
+        {
+            const auto low  = (word & LOW_MASK) * factor + carry;
+            const auto high = (word >> HALF_WIDTH) * factor + (low >> HALF_WIDTH);
+
+            word  = (high << HALF_WIDTH) | (low & LOW_MASK);
+            carry = high >> HALF_WIDTH;
+        }
+
+        if (carry != 0)
+        {
+            words.push_back(carry);
+        }
+
+        normalize();
+
+        return *this;
+    }
+    /**
+     * Divides the index by a 32-bit divisor and returns the remainder.
+     *
+     * @param divisor Divisor. Must not be `0`.
+     * @return Remainder of the division.
+     */
+    uint32_t divide(const uint32_t divisor) noexcept
+    {
+        assert(divisor != 0 && "Division by zero.");
+
+        uint64_t remainder = 0;
+
+        // since the remainder is smaller than the divisor, each 32-bit half of a word can be divided in 64 bits
+        for (auto it = words.rbegin(); it != words.rend(); ++it)
+        {
+            const auto high = (remainder << HALF_WIDTH) | (*it >> HALF_WIDTH);
+            const auto low  = ((high % divisor) << HALF_WIDTH) | (*it & LOW_MASK);
+
+            *it       = ((high / divisor) << HALF_WIDTH) | (low / divisor);
+            remainder = low % divisor;
+        }
+
+        normalize();
+
+        return static_cast<uint32_t>(remainder);
+    }
+    /**
+     * Checks whether the index fits into 64 bits.
+     *
+     * @return `true` iff the index is smaller than \f$ 2^{64} \f$.
+     */
+    [[nodiscard]] bool fits_uint64() const noexcept
+    {
+        return words.size() <= 1;
+    }
+    /**
+     * Converts the index into a 64-bit value. The index must fit into 64 bits.
+     *
+     * @return Value of the index.
+     */
+    [[nodiscard]] uint64_t to_uint64() const noexcept
+    {
+        assert(fits_uint64() && "The charge distribution index does not fit into 64 bits.");
+
+        return words.empty() ? 0 : words.front();
+    }
+    /**
+     * Returns the number of 64-bit words that are required to store the index.
+     *
+     * @return Number of words.
+     */
+    [[nodiscard]] std::size_t num_words() const noexcept
+    {
+        return words.size();
+    }
+    /**
+     * Converts the index into its decimal representation, e.g., to store or log the position of a partitioned
+     * enumeration.
+     *
+     * @return Decimal representation of the index.
+     */
+    [[nodiscard]] std::string to_string() const
+    {
+        if (words.empty())
+        {
+            return "0";
+        }
+
+        auto        quotient = *this;
+        std::string digits{};
+
+        while (!quotient.words.empty())
+        {
+            auto chunk = quotient.divide(DECIMAL_CHUNK);
+
+            // all chunks except for the most significant one are padded with zeros
+            for (uint64_t i = 0; i < DECIMAL_CHUNK_DIGITS && (chunk != 0 || !quotient.words.empty()); ++i)
+            {
+                digits.push_back(static_cast<char>('0' + chunk % 10));
+                chunk /= 10;
+            }
+        }
+
+        std::reverse(digits.begin(), digits.end());
+
+        return digits;
+    }
+    /**
+     * Parses the decimal representation of an index (see `to_string`).
+     *
+     * @param decimal Decimal representation that consists of digits only.
+     * @return Parsed index.
+     */
+    [[nodiscard]] static charge_distribution_index from_string(const std::string& decimal) noexcept
+    {
+        charge_distribution_index result{};
+
+        for (const auto d : decimal)
+        {
+            assert(d >= '0' && d <= '9' && "Invalid decimal digit.");
+
+            result *= 10;
+            result += static_cast<uint64_t>(d - '0');
+        }
+
+        return result;
+    }
+
+    friend bool operator==(const charge_distribution_index& lhs, const charge_distribution_index& rhs) noexcept
+    {
+        return lhs.words == rhs.words;
+    }
+
+    friend bool operator!=(const charge_distribution_index& lhs, const charge_distribution_index& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const charge_distribution_index& lhs, const charge_distribution_index& rhs) noexcept
+    {
+        if (lhs.words.size() != rhs.words.size())
+        {
+            return lhs.words.size() < rhs.words.size();
+        }
+
+        return std::lexicographical_compare(lhs.words.crbegin(), lhs.words.crend(), rhs.words.crbegin(),
+                                            rhs.words.crend());
+    }
+
+    friend bool operator>(const charge_distribution_index& lhs, const charge_distribution_index& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const charge_distribution_index& lhs, const charge_distribution_index& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const charge_distribution_index& lhs, const charge_distribution_index& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const charge_distribution_index& index)
+    {
+        return os << index.to_string();
+    }
+
+  private:
+    /**
+     * Words of the index in ascending order of significance. The most significant word is never `0` such that the
+     * representation of each index is unique and `0` is represented by no words at all.
+     */
+    std::vector<uint64_t> words{};
+    /**
+     * Number of bits of half a word.
+     */
+    static constexpr const uint64_t HALF_WIDTH = 32;
+    /**
+     * Mask of the less significant half of a word.
+     */
+    static constexpr const uint64_t LOW_MASK = (uint64_t{1} << HALF_WIDTH) - 1;
+    /**
+     * Largest power of ten that fits into 32 bits, which is used to convert the index into its decimal representation.
+     */
+    static constexpr const uint32_t DECIMAL_CHUNK = 1'000'000'000;
+    /**
+     * Number of decimal digits of `DECIMAL_CHUNK - 1`.
+     */
+    static constexpr const uint64_t DECIMAL_CHUNK_DIGITS = 9;
+
+    /**
+     * Removes leading zero words.
+     */
+    void normalize() noexcept
+    {
+        while (!words.empty() && words.back() == 0)
+        {
+            words.pop_back();
+        }
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_CHARGE_DISTRIBUTION_INDEX_HPP
@@ -8,10 +8,16 @@
 #include "fiction/algorithms/path_finding/distance.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/layouts/cell_level_layout.hpp"
+#include "fiction/technology/charge_distribution_index.hpp"
+#include "fiction/technology/physical_constants.hpp"
 #include "fiction/technology/sidb_charge_state.hpp"
+#include "fiction/technology/sidb_defects.hpp"
 #include "fiction/technology/sidb_nm_position.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
+#include "fiction/utils/aligned_matrix.hpp"
+#include "fiction/utils/simd_utils.hpp"
+#include "fiction/utils/sparse_matrix.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -20,10 +26,13 @@
 #include <cstdlib>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <optional>
 #include <random>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace fiction
 {
@@ -35,43 +44,71 @@ namespace fiction
  * @tparam Lyt Cell-level layout based in SiQAD-coordinates.
  * @tparam has_sidb_charge_distribution Automatically determines whether a charge distribution interface is already
  * present.
+ * @tparam FloatType Floating-point type in which the potential matrix and the local potentials are stored. Using
+ * `float` halves their memory footprint and doubles the number of SiDBs that the vectorized kernels process per
+ * instruction at the cost of precision. Distances, energies, and all values returned by the interface remain `double`.
  */
-template <typename Lyt, bool has_charge_distribution_interface =
-                            std::conjunction_v<has_assign_charge_state<Lyt>, has_get_charge_state<Lyt>>>
+template <typename Lyt,
+          bool has_charge_distribution_interface =
+              std::conjunction_v<has_assign_charge_state<Lyt>, has_get_charge_state<Lyt>>,
+          typename FloatType = double>
 class charge_distribution_surface : public Lyt
 {};
 
-template <typename Lyt>
-class charge_distribution_surface<Lyt, true> : public Lyt
+template <typename Lyt, typename FloatType>
+class charge_distribution_surface<Lyt, true, FloatType> : public Lyt
 {
   public:
     explicit charge_distribution_surface(const Lyt& lyt) : Lyt(lyt) {}
 };
 
-template <typename Lyt>
-class charge_distribution_surface<Lyt, false> : public Lyt
+template <typename Lyt, typename FloatType>
+class charge_distribution_surface<Lyt, false, FloatType> : public Lyt
 {
+    static_assert(std::is_floating_point_v<FloatType>, "FloatType is not a floating-point type");
+
+    // surfaces of different precision convert into each other
+    template <typename, bool, typename>
+    friend class charge_distribution_surface;
+
   public:
-    using charge_index_base = typename std::pair<uint64_t, uint8_t>;
+    using charge_index_base = typename std::pair<charge_distribution_index, uint8_t>;
+    /**
+     * A fixed external charge, e.g., a charged defect, given by its position and its physical properties.
+     */
+    using external_charge = typename std::pair<typename Lyt::cell, sidb_defect>;
 
-    struct charge_distribution_storage
+    /**
+     * The charge-independent part of a charge distribution surface, i.e., the physical parameters, the SiDB order, and
+     * the distance and potential matrices. It is immutable once constructed and shared among all copies of a charge
+     * distribution surface. Changing the physical parameters creates a new model (copy-on-write).
+     *
+     * If the physical parameters specify a cutoff radius, the dense matrices are not constructed. Instead, only the
+     * potentials between SiDBs within the cutoff radius are stored in a sparse matrix and distances are computed from
+     * the SiDB positions on demand such that the model requires \f$ O(n) \f$ instead of \f$ O(n^2) \f$ memory for
+     * layouts of bounded SiDB density.
+     */
+    struct charge_distribution_model
     {
-      private:
         /**
-         * The distance matrix is a vector of vectors storing the euclidean distance.
+         * The SiDB positions are stored in the order of the SiDBs.
+         */
+        using position_vector = std::vector<std::pair<double, double>>;
+        /**
+         * The distance matrix is symmetric and only accessed element-wise. Hence, only its upper triangle is stored.
          */
-        using distance_matrix = std::vector<std::vector<double>>;
+        using distance_matrix = packed_symmetric_matrix<double>;
         /**
-         * The potential matrix is a vector of vectors storing the electrostatic potentials.
+         * The potential matrix is stored contiguously with cache-aligned rows such that entire rows can be traversed
+         * by vectorized kernels (see simd_utils.hpp).
          */
-        using potential_matrix = std::vector<std::vector<double>>;
+        using potential_matrix = aligned_matrix<FloatType>;
         /**
-         * It is a vector that stores the local electrostatic potential.
+         * The potentials between SiDBs within the cutoff radius are stored row by row in CSR format.
          */
-        using local_potential = std::vector<double>;
+        using sparse_potential_matrix = csr_matrix<FloatType>;
 
-      public:
-        explicit charge_distribution_storage(const sidb_simulation_parameters& params = sidb_simulation_parameters{}) :
+        explicit charge_distribution_model(const sidb_simulation_parameters& params = sidb_simulation_parameters{}) :
                 phys_params{params} {};
         /**
          * Stores all physical parameters used for the simulation.
@@ -82,21 +119,84 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          */
         std::vector<typename Lyt::cell> sidb_order{};
         /**
-         * The SiDBs' charge states are stored. Corresponding cells are stored in `sidb_order`.
+         * Positions of the SiDBs (unit: m) in the order of `sidb_order`. The positions and the matrices are shared by
+         * models that only differ in physical parameters they do not depend on, e.g., the chemical potential. Hence,
+         * creating a model for new physical parameters only computes the parts that actually change.
          */
-        std::vector<sidb_charge_state> cell_charge{};
+        std::shared_ptr<const position_vector> sidb_positions{std::make_shared<const position_vector>()};
+        /**
+         * Distance between SiDBs are stored as matrix. It is empty if a cutoff radius is used.
+         */
+        std::shared_ptr<const distance_matrix> dist_mat{std::make_shared<const distance_matrix>()};
+        /**
+         * Electrostatic potential between SiDBs are stored as matrix (here, still charge-independent). It is empty if
+         * a cutoff radius is used.
+         */
+        std::shared_ptr<const potential_matrix> pot_mat{std::make_shared<const potential_matrix>()};
+        /**
+         * Electrostatic potential between SiDBs within the cutoff radius (here, still charge-independent). It is only
+         * used if a cutoff radius is used.
+         */
+        std::shared_ptr<const sparse_potential_matrix> sparse_pot_mat{
+            std::make_shared<const sparse_potential_matrix>()};
+        /**
+         * Fixed external charges, e.g., charged defects, that act on the SiDBs.
+         */
+        std::vector<external_charge> external_charges{};
+        /**
+         * Electrostatic potential caused by the external charges at each SiDB position. It is empty if there are no
+         * external charges.
+         */
+        std::vector<double> external_pot{};
+        /**
+         * Checks whether the potentials are stored sparsely, i.e., whether a cutoff radius is used.
+         *
+         * @return `true` iff the cutoff radius of the physical parameters is larger than 0.
+         */
+        [[nodiscard]] bool is_sparse() const noexcept
+        {
+            return phys_params.cutoff_radius > 0.0;
+        }
+    };
+
+    struct charge_distribution_storage
+    {
+      private:
+        /**
+         * It is a cache-aligned vector that stores the local electrostatic potential.
+         */
+        using local_potential = aligned_vector<FloatType>;
+
+      public:
+        explicit charge_distribution_storage(const sidb_simulation_parameters& params = sidb_simulation_parameters{}) :
+                model{std::make_shared<const charge_distribution_model>(params)} {};
         /**
-         * Distance between SiDBs are stored as matrix.
+         * The shared, charge-independent model. Copies of a charge distribution surface only copy this pointer such
+         * that copying costs \f$ O(n) \f$ instead of \f$ O(n^2) \f$.
          */
-        distance_matrix dist_mat{};
+        std::shared_ptr<const charge_distribution_model> model;
         /**
-         * Electrostatic potential between SiDBs are stored as matrix (here, still charge-independent).
+         * The SiDBs' charge states are stored. Corresponding cells are stored in `sidb_order` of the model.
          */
-        potential_matrix pot_mat{};
+        std::vector<sidb_charge_state> cell_charge{};
         /**
          * Electrostatic potential at each SiDB position. Has to be updated when charge distribution is changed.
          */
         local_potential loc_pot{};
+        /**
+         * The SiDBs' charge states that are currently accounted for in `loc_pot`. It is used to update the local
+         * potentials incrementally if only a few SiDBs changed their charge state.
+         */
+        std::vector<sidb_charge_state> loc_pot_charge{};
+        /**
+         * Indices of all SiDBs whose charge state was changed since `loc_pot` was last updated (dirty set).
+         */
+        std::vector<uint64_t> dirty_sidbs{};
+        /**
+         * The signs of the SiDBs' charge states as floating-point numbers. It is a scratch buffer that is refreshed
+         * from `cell_charge` whenever it is passed to the vectorized kernels.
+         */
+        aligned_vector<FloatType> charge_signs{};
         /**
          * Stores the electrostatic energy of a given charge distribution.
          */
@@ -114,7 +214,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
          * Depending on the number of SiDBs and the base number, a maximal number of possible charge distributions
          * exists.
          */
-        uint64_t max_charge_index{};
+        charge_distribution_index max_charge_index{};
     };
 
     using storage = std::shared_ptr<charge_distribution_storage>;
@@ -156,14 +256,124 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         initialize(cs);
     };
     /**
-     * Copy constructor.
+     * Constructor for layouts whose SiDBs are a subset of the SiDBs of another charge distribution surface, e.g., one
+     * input pattern of a gate layout whose input SiDBs are all contained in `superset`. Instead of being recomputed,
+     * the distances and potentials are gathered from the model of `superset`, whose physical parameters are used. If
+     * both layouts contain the same SiDBs, the model is shared.
+     *
+     * @param lyt The layout to be used as base. All of its SiDBs must be contained in `superset`.
+     * @param superset Charge distribution surface whose model is reused.
+     * @param cs The charge state used for the initialization of all SiDBs, default is a negative charge.
+     */
+    explicit charge_distribution_surface(const Lyt& lyt, const charge_distribution_surface& superset,
+                                         const sidb_charge_state& cs = sidb_charge_state::NEGATIVE) :
+            Lyt(lyt),
+            strg{std::make_shared<charge_distribution_storage>(superset.get_phys_params())}
+    {
+        static_assert(has_siqad_coord_v<Lyt>, "Lyt is not based on SiQAD coordinates");
+        static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+        static_assert(has_sidb_technology_v<Lyt>, "Lyt is not an SiDB layout");
+
+        initialize(cs, &superset);
+    }
+    /**
+     * Copy constructor. The charge-independent model is shared with `lyt` such that only the charge distribution and
+     * the local potentials are copied.
      *
      * @param lyt charge_distribution_surface
      */
-    explicit charge_distribution_surface(const charge_distribution_surface<Lyt>& lyt) :
+    explicit charge_distribution_surface(const charge_distribution_surface& lyt) :
             Lyt(lyt),
             strg{std::make_shared<charge_distribution_storage>(*lyt.strg)}
     {}
+    /**
+     * Converting constructor for charge distribution surfaces of a different precision. The SiDB order, the positions,
+     * and the distances are taken over and the potentials are converted to `FloatType` instead of being recomputed.
+     * The charge distribution is copied, whereas the local potentials, the system energy, and the validity are
+     * recomputed in the new precision.
+     *
+     * @tparam OtherFloatType Floating-point type of the potentials of `lyt`.
+     * @param lyt Charge distribution surface of a different precision.
+     */
+    template <typename OtherFloatType, std::enable_if_t<!std::is_same_v<OtherFloatType, FloatType>, bool> = true>
+    explicit charge_distribution_surface(const charge_distribution_surface<Lyt, false, OtherFloatType>& lyt) :
+            Lyt(lyt),
+            strg{std::make_shared<charge_distribution_storage>(lyt.get_phys_params())}
+    {
+        const auto& other_model = *lyt.strg->model;
+
+        auto model            = std::make_shared<charge_distribution_model>(other_model.phys_params);
+        model->sidb_order     = other_model.sidb_order;
+        model->sidb_positions = other_model.sidb_positions;
+        model->dist_mat       = other_model.dist_mat;
+        model->external_pot   = other_model.external_pot;
+
+        for (const auto& charge : other_model.external_charges)
+        {
+            model->external_charges.push_back(charge);
+        }
+
+        if (other_model.is_sparse())
+        {
+            const auto& other_mat = *other_model.sparse_pot_mat;
+
+            csr_matrix<FloatType> sparse_pot_mat{};
+            sparse_pot_mat.reserve(other_mat.size(), other_mat.num_non_zeros());
+
+            for (uint64_t i = 0u; i < other_mat.size(); ++i)
+            {
+                const auto* cols = other_mat.row_columns(i);
+                const auto* vals = other_mat.row_values(i);
+
+                for (std::size_t k = 0; k < other_mat.row_size(i); ++k)
+                {
+                    sparse_pot_mat.push_back(cols[k], static_cast<FloatType>(vals[k]));
+                }
+
+                sparse_pot_mat.end_row();
+            }
+
+            model->sparse_pot_mat = std::make_shared<const csr_matrix<FloatType>>(std::move(sparse_pot_mat));
+        }
+        else
+        {
+            const auto  num_sidbs = other_model.sidb_order.size();
+            const auto& other_mat = *other_model.pot_mat;
+
+            aligned_matrix<FloatType> pot_mat(num_sidbs, num_sidbs, 0);
+
+            for (uint64_t i = 0u; i < num_sidbs; ++i)
+            {
+                for (uint64_t j = 0u; j < num_sidbs; ++j)
+                {
+                    pot_mat[i][j] = static_cast<FloatType>(other_mat[i][j]);
+                }
+            }
+
+            model->pot_mat = std::make_shared<const aligned_matrix<FloatType>>(std::move(pot_mat));
+        }
+
+        strg->model       = std::move(model);
+        strg->cell_charge = lyt.strg->cell_charge;
+
+        this->charge_distribution_to_index();
+        this->initialize_max_charge_index();
+        this->update_local_potential();
+        this->recompute_system_energy();
+        this->validity_check();
+    }
+    /**
+     * Move constructor.
+     *
+     * @param lyt charge_distribution_surface
+     */
+    charge_distribution_surface(charge_distribution_surface&& lyt) = default;
+    /**
+     * Move assignment operator.
+     *
+     * @param other charge_distribution_surface.
+     */
+    charge_distribution_surface& operator=(charge_distribution_surface&& other) = default;
     /**
      * Copy assignment operator.
      *
@@ -173,6 +383,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (this != &other)
         {
+            Lyt::operator=(other);
             strg = std::make_shared<charge_distribution_storage>(*other.strg);
         }
 
@@ -195,44 +406,79 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     [[nodiscard]] std::vector<std::pair<double, double>> get_all_sidb_location_in_nm() const noexcept
     {
         std::vector<std::pair<double, double>> positions{};
-        positions.reserve(strg->sidb_order.size());
+        positions.reserve(strg->model->sidb_order.size());
 
-        for (const auto& cell : strg->sidb_order)
+        for (const auto& cell : strg->model->sidb_order)
         {
-            auto pos = sidb_nm_position<Lyt>(strg->phys_params, cell);
+            auto pos = sidb_nm_position<Lyt>(strg->model->phys_params, cell);
             positions.push_back(std::make_pair(pos.first, pos.second));
         }
 
         return positions;
     }
     /**
-     * Set the physical parameters for the simulation.
+     * Set the physical parameters for the simulation. Since the model is shared with all copies of this charge
+     * distribution surface, a new model is created. It shares the SiDB positions and the matrices with the previous
+     * model unless they have to be recomputed, i.e., the distance matrix is only recomputed if the lattice constants
+     * changed and the potential matrix only if the lattice constants, the screening parameters, or the cutoff radius
+     * changed. Hence, changing, e.g., only the chemical potential takes \f$ O(n) \f$ instead of \f$ O(n^2) \f$ time.
      *
      * @param params Physical parameters to be set.
      */
     void set_physical_parameters(const sidb_simulation_parameters& params) noexcept
     {
-        if ((strg->phys_params.lat_a == params.lat_a) && (strg->phys_params.lat_b == params.lat_b) &&
-            (strg->phys_params.lat_c == params.lat_c))
+        const auto& old_params = strg->model->phys_params;
+
+        const bool same_lattice   = (old_params.lat_a == params.lat_a) && (old_params.lat_b == params.lat_b) &&
+                                  (old_params.lat_c == params.lat_c);
+        const bool same_screening = (old_params.k == params.k) && (old_params.lambda_tf == params.lambda_tf);
+        const bool same_cutoff    = old_params.cutoff_radius == params.cutoff_radius;
+        const bool was_sparse     = strg->model->is_sparse();
+
+        auto model         = std::make_shared<charge_distribution_model>(*strg->model);
+        model->phys_params = params;
+
+        if (!same_lattice)
         {
-            strg->phys_params         = params;
-            strg->charge_index.second = params.base;
-            strg->max_charge_index    = static_cast<uint64_t>(std::pow(strg->phys_params.base, this->num_cells())) - 1;
-            this->update_local_potential();
-            this->recompute_system_energy();
-            this->validity_check();
+            this->initialize_sidb_positions(*model);
+        }
+
+        if (model->is_sparse())
+        {
+            model->dist_mat = std::make_shared<const packed_symmetric_matrix<double>>();
+            model->pot_mat  = std::make_shared<const aligned_matrix<FloatType>>();
+
+            if (!same_lattice || !same_screening || !same_cutoff)
+            {
+                this->initialize_sparse_potential_matrix(*model);
+            }
         }
         else
         {
-            strg->phys_params = params;
-            this->initialize_distance_matrix();
-            this->initialize_potential_matrix();
-            strg->charge_index.second = params.base;
-            strg->max_charge_index    = static_cast<uint64_t>(std::pow(strg->phys_params.base, this->num_cells())) - 1;
-            this->update_local_potential();
-            this->recompute_system_energy();
-            this->validity_check();
+            model->sparse_pot_mat = std::make_shared<const csr_matrix<FloatType>>();
+
+            if (!same_lattice || was_sparse)
+            {
+                this->initialize_distance_matrix(*model);
+            }
+            if (!same_lattice || !same_screening || was_sparse)
+            {
+                this->initialize_potential_matrix(*model);
+            }
+        }
+
+        if (!same_lattice || !same_screening)
+        {
+            initialize_external_potential(*model);
         }
+
+        strg->model = std::move(model);
+
+        strg->charge_index.second = params.base;
+        this->initialize_max_charge_index();
+        this->update_local_potential();
+        this->recompute_system_energy();
+        this->validity_check();
     }
     /**
      * Delete the assign_cell_type function of the underlying layout.
@@ -255,7 +501,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] sidb_simulation_parameters get_phys_params() const noexcept
     {
-        return strg->phys_params;
+        return strg->model->phys_params;
     }
     /**
      * This function assigns the given charge state to the cell of the layout at the specified index. It updates the
@@ -267,6 +513,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     void assign_charge_by_cell_index(const uint64_t i, const sidb_charge_state& cs) const noexcept
     {
         strg->cell_charge[i] = cs;
+        this->mark_charge_change(i);
         this->charge_distribution_to_index();
     }
     /**
@@ -280,6 +527,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         if (auto index = cell_to_index(c); index != -1)
         {
             strg->cell_charge[static_cast<uint64_t>(index)] = cs;
+            this->mark_charge_change(static_cast<uint64_t>(index));
         }
 
         this->charge_distribution_to_index();
@@ -296,6 +544,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
                                            const bool update_chargeconf = true) noexcept
     {
         strg->cell_charge[index] = cs;
+        this->mark_charge_change(index);
 
         if (update_chargeconf)
         {
@@ -312,6 +561,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         for (uint64_t i = 0u; i < strg->cell_charge.size(); ++i)
         {
             strg->cell_charge[i] = cs;
+            this->mark_charge_change(i);
         }
 
         this->charge_distribution_to_index();
@@ -331,7 +581,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             {
                 if (const auto local_pot = this->get_local_potential(c); local_pot.has_value())
                 {
-                    if (-*local_pot + strg->phys_params.mu < -physical_constants::POP_STABILITY_ERR)
+                    if (-*local_pot + strg->model->phys_params.mu < -physical_constants::POP_STABILITY_ERR)
                     {
                         negative_sidbs.push_back(cell_to_index(c));
                     }
@@ -377,10 +627,10 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] int64_t cell_to_index(const typename Lyt::cell& c) const noexcept
     {
-        if (const auto it = std::find(strg->sidb_order.cbegin(), strg->sidb_order.cend(), c);
-            it != strg->sidb_order.cend())
+        if (const auto it = std::find(strg->model->sidb_order.cbegin(), strg->model->sidb_order.cend(), c);
+            it != strg->model->sidb_order.cend())
         {
-            return static_cast<int64_t>(std::distance(strg->sidb_order.cbegin(), it));
+            return static_cast<int64_t>(std::distance(strg->model->sidb_order.cbegin(), it));
         }
 
         return -1;
@@ -397,7 +647,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->dist_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return distance_by_indices(*strg->model, static_cast<uint64_t>(index1), static_cast<uint64_t>(index2));
         }
 
         return 0;
@@ -411,7 +661,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] double get_distance_by_indices(const uint64_t index1, const uint64_t index2) const noexcept
     {
-        return strg->dist_mat[index1][index2];
+        return distance_by_indices(*strg->model, index1, index2);
     }
     /**
      * Returns the chargeless electrostatic potential between two cells.
@@ -428,7 +678,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)];
+            return stored_potential_by_indices(*strg->model, static_cast<uint64_t>(index1),
+                                               static_cast<uint64_t>(index2));
         }
 
         return 0;
@@ -448,14 +699,16 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index1 = cell_to_index(c1), index2 = cell_to_index(c2); (index1 != -1) && (index2 != -1))
         {
-            return strg->pot_mat[static_cast<uint64_t>(index1)][static_cast<uint64_t>(index2)] *
+            return stored_potential_by_indices(*strg->model, static_cast<uint64_t>(index1),
+                                               static_cast<uint64_t>(index2)) *
                    charge_state_to_sign(get_charge_state(c2));
         }
 
         return 0;
     }
     /**
-     * Calculates and returns the potential of two indices.
+     * Calculates and returns the potential of two indices. If a cutoff radius is used, the potential between SiDBs
+     * farther apart is `0`.
      *
      * @param index1 The first index.
      * @param index2 The second index.
@@ -464,7 +717,86 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     [[nodiscard]] double get_electrostatic_potential_by_indices(const uint64_t index1,
                                                                 const uint64_t index2) const noexcept
     {
-        return strg->pot_mat[index1][index2];
+        return stored_potential_by_indices(*strg->model, index1, index2);
+    }
+    /**
+     * Checks whether only the potentials between SiDBs within the cutoff radius of the physical parameters are stored.
+     *
+     * @return `true` iff a cutoff radius is used.
+     */
+    [[nodiscard]] bool has_sparse_potentials() const noexcept
+    {
+        return strg->model->is_sparse();
+    }
+    /**
+     * Returns the number of ordered pairs of distinct SiDBs whose potentials are stored, i.e., \f$ n (n - 1) \f$ if no
+     * cutoff radius is used and twice the number of SiDB pairs within the cutoff radius otherwise.
+     *
+     * @return Number of stored interactions.
+     */
+    [[nodiscard]] uint64_t num_interactions() const noexcept
+    {
+        const auto& model = *strg->model;
+
+        if (model.is_sparse())
+        {
+            return model.sparse_pot_mat->num_non_zeros();
+        }
+
+        return model.sidb_order.size() * (model.sidb_order.empty() ? 0 : model.sidb_order.size() - 1);
+    }
+    /**
+     * Assigns fixed external charges, e.g., charged defects, that replace all previously assigned ones. Their
+     * electrostatic potential at each SiDB position is computed once and included in the local potentials such that
+     * they do not slow down subsequent charge changes. Since the model is shared with all copies of this charge
+     * distribution surface, a new model is created.
+     *
+     * The potential of an external charge uses its own relative permittivity and screening distance (in nm) if they
+     * are larger than 0 and those of the physical parameters otherwise. It is not affected by the cutoff radius.
+     *
+     * @param charges External charges given by their positions and physical properties.
+     */
+    void assign_external_charges(const std::vector<external_charge>& charges) noexcept
+    {
+        auto model = std::make_shared<charge_distribution_model>(*strg->model);
+
+        model->external_charges.clear();
+        model->external_charges.reserve(charges.size());
+
+        for (const auto& charge : charges)
+        {
+            model->external_charges.push_back(charge);
+        }
+
+        initialize_external_potential(*model);
+
+        strg->model = std::move(model);
+
+        this->update_local_potential();
+        this->recompute_system_energy();
+        this->validity_check();
+    }
+    /**
+     * Returns the fixed external charges that act on the SiDBs. If the underlying layout is an `sidb_surface`, they
+     * include its charged defects.
+     *
+     * @return External charges given by their positions and physical properties.
+     */
+    [[nodiscard]] std::vector<external_charge> get_external_charges() const noexcept
+    {
+        return strg->model->external_charges;
+    }
+    /**
+     * Returns the electrostatic potential caused by all external charges at the given SiDB.
+     *
+     * @param index The index of the SiDB.
+     * @return The external potential at the SiDB. It is `0` if there are no external charges.
+     */
+    [[nodiscard]] double get_external_potential_by_index(const uint64_t index) const noexcept
+    {
+        const auto& external_pot = strg->model->external_pot;
+
+        return external_pot.empty() ? 0.0 : external_pot[index];
     }
     /**
      * The electrostatic potential between two cells (SiDBs) is calculated.
@@ -475,14 +807,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] double potential_between_sidbs_by_index(const uint64_t index1, const uint64_t index2) const noexcept
     {
-        if (strg->dist_mat[index1][index2] == 0)
-        {
-            return 0.0;
-        }
-
-        return (strg->phys_params.k / strg->dist_mat[index1][index2] *
-                std::exp(-strg->dist_mat[index1][index2] / strg->phys_params.lambda_tf) *
-                physical_constants::ELECTRIC_CHARGE);
+        return potential_between_sidbs_by_index(*strg->model, index1, index2);
     }
     /**
      * Calculates and returns the potential of a pair of cells based on their distance and simulation parameters.
@@ -500,22 +825,83 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         return potential_between_sidbs_by_index(index1, index2);
     }
     /**
-     * The function calculates the electrostatic potential for each SiDB position (local).
+     * The function calculates the electrostatic potential for each SiDB position (local). Each local potential is the
+     * dot product of one row of the potential matrix with the charge signs, which is computed by a vectorized kernel.
+     * If a cutoff radius is used, only the SiDBs within the cutoff radius contribute. The potential of the external
+     * charges is added.
      */
     void update_local_potential() noexcept
     {
         strg->loc_pot.resize(this->num_cells(), 0);
 
-        for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+        this->update_charge_signs();
+
+        const auto& model = *strg->model;
+
+        if (model.is_sparse())
+        {
+            const auto& sparse_pot_mat = *model.sparse_pot_mat;
+
+            for (uint64_t i = 0u; i < sparse_pot_mat.size(); ++i)
+            {
+                strg->loc_pot[i] = sparse_pot_mat.dot_row(i, strg->charge_signs.data());
+            }
+        }
+        else
+        {
+            const auto& pot_mat = *model.pot_mat;
+
+            for (uint64_t i = 0u; i < pot_mat.size(); ++i)
+            {
+                strg->loc_pot[i] = dot_product(pot_mat[i], strg->charge_signs.data(), pot_mat.size());
+            }
+        }
+
+        // the potential of the external charges is static; hence, it is only added here and retained by all
+        // incremental updates
+        for (uint64_t i = 0u; i < model.external_pot.size(); ++i)
+        {
+            strg->loc_pot[i] += static_cast<FloatType>(model.external_pot[i]);
+        }
+
+        strg->loc_pot_charge = strg->cell_charge;
+        strg->dirty_sidbs.clear();
+    }
+    /**
+     * The function updates the local electrostatic potential at each SiDB position incrementally. Only the
+     * contributions of those SiDBs that changed their charge state since the last update are adjusted, which requires
+     * a single pass over one column of the potential matrix per changed SiDB, i.e., \f$ O(n) \f$ instead of \f$
+     * O(n^2) \f$ for a single charge change. If too many SiDBs changed their charge state for an incremental update to
+     * pay off, all local potentials are recomputed via `update_local_potential`.
+     */
+    void update_local_potential_incrementally() noexcept
+    {
+        const auto num_sidbs = strg->model->sidb_order.size();
+
+        if (strg->loc_pot.size() != num_sidbs || 2 * strg->dirty_sidbs.size() > num_sidbs)
+        {
+            this->update_local_potential();
+
+            return;
+        }
+
+        for (const auto& changed : strg->dirty_sidbs)
         {
-            double collect = 0;
-            for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
+            const auto delta = charge_state_to_sign(strg->cell_charge[changed]) -
+                               charge_state_to_sign(strg->loc_pot_charge[changed]);
+
+            if (delta == 0)
             {
-                collect += strg->pot_mat[i][j] * static_cast<double>(charge_state_to_sign(strg->cell_charge[j]));
+                continue;
             }
 
-            strg->loc_pot[i] = collect;
+            // the potential matrix is symmetric; hence, the row of the changed SiDB is traversed instead of its column
+            this->add_potential_row(changed, static_cast<FloatType>(delta));
+
+            strg->loc_pot_charge[changed] = strg->cell_charge[changed];
         }
+
+        strg->dirty_sidbs.clear();
     }
     /**
      * The function returns the local electrostatic potential at a given SiDB position.
@@ -528,7 +914,7 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         if (const auto index = cell_to_index(c); index != -1)
         {
-            return strg->loc_pot[static_cast<uint64_t>(index)];
+            return static_cast<double>(strg->loc_pot[static_cast<uint64_t>(index)]);
         }
 
         return std::nullopt;
@@ -542,9 +928,9 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      */
     [[nodiscard]] std::optional<double> get_local_potential_by_index(const uint64_t index) const noexcept
     {
-        if (index < strg->sidb_order.size())
+        if (index < strg->model->sidb_order.size())
         {
-            return strg->loc_pot[index];
+            return static_cast<double>(strg->loc_pot[index]);
         }
 
         return std::nullopt;
@@ -557,7 +943,8 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         strg->system_energy = 0.0;
     }
     /**
-     * Calculates the system's total electrostatic potential energy and stores it in the storage.
+     * Calculates the system's total electrostatic potential energy and stores it in the storage. In contrast to the
+     * interactions among the SiDBs, the interactions with the external charges are not counted twice.
      */
     void recompute_system_energy() noexcept
     {
@@ -565,7 +952,14 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         for (uint64_t i = 0; i < strg->loc_pot.size(); ++i)
         {
-            total_energy += 0.5 * strg->loc_pot[i] * charge_state_to_sign(strg->cell_charge[i]);
+            total_energy += 0.5 * static_cast<double>(strg->loc_pot[i]) * charge_state_to_sign(strg->cell_charge[i]);
+        }
+
+        const auto& external_pot = strg->model->external_pot;
+
+        for (uint64_t i = 0; i < external_pot.size(); ++i)
+        {
+            total_energy += 0.5 * external_pot[i] * charge_state_to_sign(strg->cell_charge[i]);
         }
 
         strg->system_energy = total_energy;
@@ -580,11 +974,13 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         return strg->system_energy;
     }
     /**
-     * The function updates the local potential and the system energy after a charge change.
+     * The function updates the local potential and the system energy after a charge change. If only a few SiDBs changed
+     * their charge state since the last update, the local potentials are updated incrementally (see
+     * `update_local_potential_incrementally`) such that the entire update requires \f$ O(n) \f$ time per changed SiDB.
      */
     void update_after_charge_change() noexcept
     {
-        this->update_local_potential();
+        this->update_local_potential_incrementally();
         this->recompute_system_energy();
         this->validity_check();
     }
@@ -597,15 +993,17 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         uint64_t population_stability_not_fulfilled_counter = 0;
         uint64_t for_loop_counter                           = 0;
 
-        for (const auto& it : strg->loc_pot)  // this for-loop checks if the "population stability" is fulfilled.
+        for (const auto& pot : strg->loc_pot)  // this for-loop checks if the "population stability" is fulfilled.
         {
+            const auto it = static_cast<double>(pot);
+
             bool valid = (((strg->cell_charge[for_loop_counter] == sidb_charge_state::NEGATIVE) &&
-                           ((-it + strg->phys_params.mu) < physical_constants::POP_STABILITY_ERR)) ||
+                           ((-it + strg->model->phys_params.mu) < physical_constants::POP_STABILITY_ERR)) ||
                           ((strg->cell_charge[for_loop_counter] == sidb_charge_state::POSITIVE) &&
-                           ((-it + strg->phys_params.mu_p) > -physical_constants::POP_STABILITY_ERR)) ||
+                           ((-it + strg->model->phys_params.mu_p) > -physical_constants::POP_STABILITY_ERR)) ||
                           ((strg->cell_charge[for_loop_counter] == sidb_charge_state::NEUTRAL) &&
-                           ((-it + strg->phys_params.mu) > -physical_constants::POP_STABILITY_ERR) &&
-                           (-it + strg->phys_params.mu_p) < physical_constants::POP_STABILITY_ERR));
+                           ((-it + strg->model->phys_params.mu) > -physical_constants::POP_STABILITY_ERR) &&
+                           (-it + strg->model->phys_params.mu_p) < physical_constants::POP_STABILITY_ERR));
             for_loop_counter += 1;
             if (!valid)
             {
@@ -620,45 +1018,11 @@ class charge_distribution_surface<Lyt, false> : public Lyt
             (for_loop_counter >
              0))  // if population stability is fulfilled for all SiDBs, the "configuration stability" is checked.
         {
-            const auto hop_del =
-                [this](const uint64_t c1, const uint64_t c2)  // energy change when charge hops between two SiDBs.
-            {
-                const int dn_i = (strg->cell_charge[c1] == sidb_charge_state::NEGATIVE) ? 1 : -1;
-                const int dn_j = -dn_i;
-
-                return strg->loc_pot[c1] * dn_i + strg->loc_pot[c2] * dn_j - strg->pot_mat[c1][c2] * 1;
-            };
-
-            uint64_t hop_counter = 0;
-            for (uint64_t i = 0u; i < strg->loc_pot.size(); ++i)
-            {
-                if (strg->cell_charge[i] == sidb_charge_state::POSITIVE)  // we do nothing with SiDB+
-                {
-                    continue;
-                }
-
-                for (uint64_t j = 0u; j < strg->loc_pot.size(); j++)
-                {
-                    if (hop_counter == 1)
-                    {
-                        break;
-                    }
-
-                    if (const auto e_del = hop_del(i, j);
-                        (charge_state_to_sign(strg->cell_charge[j]) > charge_state_to_sign(strg->cell_charge[i])) &&
-                        (e_del < -physical_constants::POP_STABILITY_ERR))  // Checks if energetically favored hops
-                                                                           // exist between two SiDBs.
-                    {
-                        hop_counter = 1;
-
-                        break;
-                    }
-                }
-            }
+            this->update_charge_signs();
 
             // If there is no jump that leads to a decrease in the potential energy of the system, the given charge
             // distribution satisfies metastability.
-            strg->validity = hop_counter == 0;
+            strg->validity = strg->model->is_sparse() ? !this->hop_exists_within_cutoff() : !this->hop_exists();
         }
     }
     /**
@@ -672,23 +1036,23 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     }
     /**
      * The charge distribution of the charge distribution surface is converted to a unique index. It is used to map
-     * every possible charge distribution of an SiDB layout to a unique index.
+     * every possible charge distribution of an SiDB layout to a unique index. The charge state of each SiDB is a digit
+     * in the simulation base, where the first SiDB is the most significant one. The index is computed exactly via
+     * Horner's method regardless of the number of SiDBs.
      */
     void charge_distribution_to_index() const noexcept
     {
-        const uint8_t base = strg->phys_params.base;
+        const uint8_t base = strg->model->phys_params.base;
 
-        uint64_t chargeindex = 0;
-        uint64_t counter     = 0;
+        charge_distribution_index chargeindex{};
 
         for (const auto& c : strg->cell_charge)
         {
-            chargeindex +=
-                static_cast<uint64_t>((charge_state_to_sign(c) + 1) * std::pow(base, this->num_cells() - counter - 1));
-            counter += 1;
+            chargeindex *= base;
+            chargeindex += static_cast<uint64_t>(charge_state_to_sign(c) + 1);
         }
 
-        strg->charge_index = {chargeindex, base};
+        strg->charge_index = {std::move(chargeindex), base};
     }
     /**
      * The charge index of the current charge distribution is returned.
@@ -706,18 +1070,13 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     {
         auto       charge_quot = strg->charge_index.first;
         const auto base        = strg->charge_index.second;
-        const auto num_charges = this->num_cells() - 1;
-        auto       counter     = num_charges;
 
-        while (charge_quot > 0)
+        // all digits are assigned, including the leading zeros, i.e., negatively charged SiDBs
+        for (auto counter = this->num_cells(); counter-- > 0;)
         {
-            const std::div_t d = std::div(static_cast<int>(charge_quot), static_cast<int>(base));
-            charge_quot        = static_cast<uint64_t>(d.quot);
+            const auto sign = static_cast<int8_t>(static_cast<int8_t>(charge_quot.divide(base)) - 1);
 
-            this->assign_charge_state_by_cell_index(counter, sign_to_charge_state(static_cast<int8_t>(d.rem - 1)),
-                                                    false);
-
-            counter -= 1;
+            this->assign_charge_state_by_cell_index(counter, sign_to_charge_state(sign), false);
         }
     }
     /**
@@ -739,16 +1098,20 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      *
      * @returns The maximal possible charge distribution index.
      */
-    [[nodiscard]] uint64_t get_max_charge_index() const noexcept
+    [[nodiscard]] charge_distribution_index get_max_charge_index() const noexcept
     {
         return strg->max_charge_index;
     }
     /**
      * Assigns a certain charge state to a given index (which corresponds to a certain SiDB) and the charge distribution
      * is updated correspondingly.
+     *
+     * @param index Charge distribution index to assign. It must not exceed the maximum charge index.
      */
-    void assign_charge_index(const uint64_t index) noexcept
+    void assign_charge_index(const charge_distribution_index& index) noexcept
     {
+        assert(index <= strg->max_charge_index && "The charge distribution index is out of range.");
+
         strg->charge_index.first = index;
         this->index_to_charge_distribution();
     }
@@ -760,9 +1123,11 @@ class charge_distribution_surface<Lyt, false> : public Lyt
      *
      * @param alpha A parameter for the algorithm (default: 0.7).
      * @param negative_indices Vector of SiDBs indices that are already negatively charged (double occupied).
+     * @param generator Random number generator used to select among the candidate SiDBs. Each thread has to use its own
+     * generator.
      */
-    void adjacent_search(const double alpha, std::vector<uint64_t>& negative_indices) noexcept
-
+    void adjacent_search(const double alpha, std::vector<uint64_t>& negative_indices,
+                         std::mt19937_64& generator) noexcept
     {
         double     dist_max     = 0;
         const auto reserve_size = this->num_cells() - negative_indices.size();
@@ -806,18 +1171,16 @@ class charge_distribution_surface<Lyt, false> : public Lyt
 
         if (!candidates.empty())
         {
-            static std::mt19937_64                  generator(std::random_device{}());
             std::uniform_int_distribution<uint64_t> dist(0, candidates.size() - 1);
             const auto                              random_element = index_vector[candidates[dist(generator)]];
             strg->cell_charge[random_element]                      = sidb_charge_state::NEGATIVE;
+            strg->loc_pot_charge[random_element]                   = sidb_charge_state::NEGATIVE;
             negative_indices.push_back(random_element);
 
             strg->system_energy += -(this->get_local_potential_by_index(random_element).value());
 
-            for (uint64_t i = 0u; i < strg->pot_mat.size(); ++i)
-            {
-                strg->loc_pot[i] += -(this->get_electrostatic_potential_by_indices(i, random_element));
-            }
+            // the potential matrix is symmetric; hence, the row of the new negative SiDB is traversed
+            this->add_potential_row(random_element, FloatType{-1});
         }
     }
 
@@ -825,62 +1188,631 @@ class charge_distribution_surface<Lyt, false> : public Lyt
     storage strg;
 
     /**
-     * Initialization function used for the construction of the charge distribution surface.
+     * Adds the SiDB at the given index to the set of SiDBs whose charge state changed since the last update of the
+     * local potentials. Once the set contains more SiDBs than the layout, all local potentials have to be recomputed
+     * anyway, which is why no further indices are recorded.
      *
-     * @param cs The charge state assigned to all SiDBs.
+     * @param index The index of the SiDB whose charge state was changed.
      */
-    void initialize(const sidb_charge_state& cs = sidb_charge_state::NEGATIVE) noexcept
+    void mark_charge_change(const uint64_t index) const noexcept
     {
-        strg->sidb_order.reserve(this->num_cells());
-        strg->cell_charge.reserve(this->num_cells());
-        this->foreach_cell([this](const auto& c1) { strg->sidb_order.push_back(c1); });
-        this->foreach_cell([this, &cs](const auto&) { strg->cell_charge.push_back(cs); });
-
-        assert((((this->num_cells() < 41) && (strg->phys_params.base == 3)) ||
-                ((strg->phys_params.base == 2) && (this->num_cells() < 64))) &&
-               "number of SiDBs is too large");
-
-        this->charge_distribution_to_index();
-        this->initialize_distance_matrix();
-        this->initialize_potential_matrix();
-        strg->max_charge_index =
-            static_cast<uint64_t>(std::pow(static_cast<double>(strg->phys_params.base), this->num_cells()) - 1);
-        this->update_local_potential();
-        this->recompute_system_energy();
-        this->validity_check();
-    };
+        if (strg->dirty_sidbs.size() <= strg->model->sidb_order.size())
+        {
+            strg->dirty_sidbs.push_back(index);
+        }
+    }
 
     /**
-     * Initializes the distance matrix between all the cells of the layout.
+     * Adds the scaled row of the potential matrix that belongs to the given SiDB to the local potentials, i.e., it
+     * accounts for a change of the SiDB's charge sign by `delta`.
+     *
+     * @param index The index of the SiDB whose charge state was changed.
+     * @param delta Change of the SiDB's charge sign.
      */
-    void initialize_distance_matrix() const noexcept
+    void add_potential_row(const uint64_t index, const FloatType delta) const noexcept
     {
-        strg->dist_mat = std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0));
+        const auto& model = *strg->model;
 
-        for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+        if (model.is_sparse())
         {
-            for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
-            {
-                strg->dist_mat[i][j] =
-                    sidb_nanometer_distance<Lyt>(*this, strg->sidb_order[i], strg->sidb_order[j], strg->phys_params);
-            }
+            model.sparse_pot_mat->scaled_add_row(index, delta, strg->loc_pot.data());
+        }
+        else
+        {
+            scaled_add(strg->loc_pot.data(), (*model.pot_mat)[index], delta, strg->loc_pot.size());
         }
     }
     /**
-     * Initializes the potential matrix between all the cells of the layout.
+     * Checks whether a hop of a charge from one SiDB to another one decreases the system energy. The charge signs have
+     * to be up to date.
+     *
+     * @return `true` iff an energetically favorable hop exists.
      */
-    void initialize_potential_matrix() const noexcept
+    [[nodiscard]] bool hop_exists() const noexcept
     {
-        strg->pot_mat = std::vector<std::vector<double>>(this->num_cells(), std::vector<double>(this->num_cells(), 0));
+        const auto& pot_mat = *strg->model->pot_mat;
 
-        for (uint64_t i = 0u; i < strg->sidb_order.size(); ++i)
+        for (uint64_t i = 0u; i < strg->loc_pot.size(); ++i)
         {
-            for (uint64_t j = 0u; j < strg->sidb_order.size(); j++)
+            if (strg->cell_charge[i] == sidb_charge_state::POSITIVE)  // we do nothing with SiDB+
             {
-                strg->pot_mat[i][j] = potential_between_sidbs_by_index(i, j);
+                continue;
             }
+
+            // energy change when a charge hops from SiDB i to SiDB j: dn_i * (loc_pot[i] - loc_pot[j]) - V_ij
+            const FloatType dn_i = (strg->cell_charge[i] == sidb_charge_state::NEGATIVE) ? 1 : -1;
+
+            // checks if energetically favored hops exist between SiDB i and any other SiDB
+            if (any_hop_below_threshold(pot_mat[i], strg->loc_pot.data(), strg->charge_signs.data(),
+                                        strg->loc_pot.size(), strg->charge_signs[i], strg->loc_pot[i], dn_i,
+                                        static_cast<FloatType>(-physical_constants::POP_STABILITY_ERR)))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Checks whether a hop of a charge from one SiDB to another one decreases the system energy if only SiDBs within
+     * the cutoff radius interact. The charge signs have to be up to date.
+     *
+     * Without interaction, a hop from SiDB i to SiDB j changes the energy by dn_i * (loc_pot[i] - loc_pot[j]). Since
+     * the potentials are positive, the interaction V_ij of SiDBs within the cutoff radius only ever makes a hop more
+     * favorable. Hence, each SiDB only has to be compared to the hop target of extreme local potential and to its
+     * neighbors, which takes \f$ O(n + m) \f$ time for \f$ m \f$ stored interactions instead of \f$ O(n^2) \f$.
+     *
+     * @return `true` iff an energetically favorable hop exists.
+     */
+    [[nodiscard]] bool hop_exists_within_cutoff() const noexcept
+    {
+        const auto& pot_mat   = *strg->model->sparse_pot_mat;
+        const auto  threshold = static_cast<FloatType>(-physical_constants::POP_STABILITY_ERR);
+
+        // negatively charged SiDBs can pass their charge to neutral and positive ones, neutral ones to positive ones
+        auto max_non_negative_potential = std::numeric_limits<FloatType>::lowest();
+        auto min_positive_potential     = std::numeric_limits<FloatType>::max();
+
+        for (uint64_t j = 0u; j < strg->loc_pot.size(); ++j)
+        {
+            if (strg->cell_charge[j] != sidb_charge_state::NEGATIVE)
+            {
+                max_non_negative_potential = std::max(max_non_negative_potential, strg->loc_pot[j]);
+            }
+            if (strg->cell_charge[j] == sidb_charge_state::POSITIVE)
+            {
+                min_positive_potential = std::min(min_positive_potential, strg->loc_pot[j]);
+            }
+        }
+
+        for (uint64_t i = 0u; i < strg->loc_pot.size(); ++i)
+        {
+            if (strg->cell_charge[i] == sidb_charge_state::POSITIVE)  // we do nothing with SiDB+
+            {
+                continue;
+            }
+
+            const bool      negative = strg->cell_charge[i] == sidb_charge_state::NEGATIVE;
+            const FloatType dn_i     = negative ? 1 : -1;
+            const FloatType v_i      = strg->loc_pot[i];
+
+            if (negative ? (v_i - max_non_negative_potential < threshold) :
+                           (min_positive_potential - v_i < threshold))
+            {
+                return true;
+            }
+
+            const auto* cols = pot_mat.row_columns(i);
+            const auto* vals = pot_mat.row_values(i);
+
+            for (std::size_t k = 0; k < pot_mat.row_size(i); ++k)
+            {
+                const auto j = cols[k];
+
+                if (strg->charge_signs[j] > strg->charge_signs[i] &&
+                    dn_i * (v_i - strg->loc_pot[j]) - vals[k] < threshold)
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+    /**
+     * Refreshes the scratch buffer `charge_signs` from the current charge states such that it can be passed to the
+     * vectorized kernels.
+     */
+    void update_charge_signs() const noexcept
+    {
+        strg->charge_signs.resize(strg->cell_charge.size());
+
+        for (uint64_t i = 0u; i < strg->cell_charge.size(); ++i)
+        {
+            strg->charge_signs[i] = static_cast<FloatType>(charge_state_to_sign(strg->cell_charge[i]));
         }
     }
+    /**
+     * Initialization function used for the construction of the charge distribution surface.
+     *
+     * @param cs The charge state assigned to all SiDBs.
+     */
+    void initialize(const sidb_charge_state&           cs       = sidb_charge_state::NEGATIVE,
+                    const charge_distribution_surface* superset = nullptr) noexcept
+    {
+        auto model = std::make_shared<charge_distribution_model>(strg->model->phys_params);
+
+        model->sidb_order.reserve(this->num_cells());
+        strg->cell_charge.reserve(this->num_cells());
+        this->foreach_cell([&model](const auto& c1) { model->sidb_order.push_back(c1); });
+        this->foreach_cell([this, &cs](const auto&) { strg->cell_charge.push_back(cs); });
+
+        if (superset == nullptr)
+        {
+            this->initialize_sidb_positions(*model);
+            this->initialize_external_charges(*model);
+
+            if (model->is_sparse())
+            {
+                this->initialize_sparse_potential_matrix(*model);
+            }
+            else
+            {
+                this->initialize_distance_matrix(*model);
+                this->initialize_potential_matrix(*model);
+            }
+
+            strg->model = std::move(model);
+        }
+        else if (superset->strg->model->sidb_order == model->sidb_order)
+        {
+            strg->model = superset->strg->model;
+        }
+        else
+        {
+            this->initialize_matrices_from_superset(*model, *superset->strg->model);
+            strg->model = std::move(model);
+        }
+
+        this->charge_distribution_to_index();
+        this->initialize_max_charge_index();
+        this->update_local_potential();
+        this->recompute_system_energy();
+        this->validity_check();
+    };
+
+    /**
+     * Initializes the positions of all SiDBs of the layout.
+     *
+     * @param model The model whose SiDB positions are initialized. Its SiDB order has to be initialized.
+     */
+    static void initialize_sidb_positions(charge_distribution_model& model) noexcept
+    {
+        typename charge_distribution_model::position_vector sidb_positions{};
+        sidb_positions.reserve(model.sidb_order.size());
+
+        for (const auto& c : model.sidb_order)
+        {
+            sidb_positions.push_back(sidb_nm_position<Lyt>(model.phys_params, c));
+        }
+
+        model.sidb_positions = std::make_shared<const typename charge_distribution_model::position_vector>(
+            std::move(sidb_positions));
+    }
+    /**
+     * Initializes the external charges with the charged defects of the layout if it provides any, e.g., if it is an
+     * `sidb_surface`, and computes their potential. The defects are ordered by their positions such that the result
+     * does not depend on the order in which they are stored.
+     *
+     * @param model The model whose external charges are initialized. Its SiDB positions have to be initialized.
+     */
+    void initialize_external_charges([[maybe_unused]] charge_distribution_model& model) const noexcept
+    {
+        if constexpr (has_foreach_sidb_defect_v<Lyt> && has_get_sidb_defect_v<Lyt>)
+        {
+            std::vector<typename Lyt::cell> charged_defects{};
+
+            this->foreach_sidb_defect(
+                [&charged_defects](const auto& cd)
+                {
+                    if (is_charged_defect(cd.second))
+                    {
+                        charged_defects.push_back(cd.first);
+                    }
+                });
+
+            std::sort(charged_defects.begin(), charged_defects.end());
+
+            model.external_charges.clear();
+            model.external_charges.reserve(charged_defects.size());
+
+            for (const auto& c : charged_defects)
+            {
+                model.external_charges.emplace_back(c, this->get_sidb_defect(c));
+            }
+
+            initialize_external_potential(model);
+        }
+    }
+    /**
+     * Computes the potential that the external charges cause at each SiDB position.
+     *
+     * @param model The model whose external potential is initialized. Its SiDB positions and external charges have to
+     * be initialized.
+     */
+    static void initialize_external_potential(charge_distribution_model& model) noexcept
+    {
+        model.external_pot.clear();
+
+        if (model.external_charges.empty())
+        {
+            return;
+        }
+
+        const auto& sidb_positions = *model.sidb_positions;
+
+        model.external_pot.assign(sidb_positions.size(), 0.0);
+
+        for (const auto& [c, defect] : model.external_charges)
+        {
+            const auto pos = sidb_nm_position<Lyt>(model.phys_params, c);
+
+            const auto k = defect.epsilon_r > 0.0 ?
+                               1.0 / (4.0 * physical_constants::PI * physical_constants::EPSILON * defect.epsilon_r) :
+                               model.phys_params.k;
+            const auto lambda_tf = defect.lambda_tf > 0.0 ? defect.lambda_tf * 1E-9 : model.phys_params.lambda_tf;
+
+            for (uint64_t i = 0u; i < sidb_positions.size(); ++i)
+            {
+                const auto distance =
+                    std::hypot(sidb_positions[i].first - pos.first, sidb_positions[i].second - pos.second);
+
+                // an external charge at the position of an SiDB is ignored like the self-interaction of an SiDB
+                if (distance == 0.0)
+                {
+                    continue;
+                }
+
+                model.external_pot[i] += k / distance * std::exp(-distance / lambda_tf) *
+                                         physical_constants::ELECTRIC_CHARGE * defect.charge;
+            }
+        }
+    }
+    /**
+     * Initializes the distance matrix between all the cells of the layout.
+     *
+     * @param model The model whose distance matrix is initialized. Its SiDB positions have to be initialized.
+     */
+    void initialize_distance_matrix(charge_distribution_model& model) const noexcept
+    {
+        const auto& sidb_positions = *model.sidb_positions;
+
+        packed_symmetric_matrix<double> dist_mat(this->num_cells(), 0);
+
+        // the distances are computed from the stored positions exactly like without a distance matrix (see
+        // `distance_by_indices`); recomputing the positions could yield slightly different distances if floating-point
+        // operations are contracted differently (e.g., when compiling with FMA support)
+        for (uint64_t i = 0u; i < model.sidb_order.size(); ++i)
+        {
+            for (uint64_t j = i + 1; j < model.sidb_order.size(); j++)
+            {
+                const auto& pos1 = sidb_positions[i];
+                const auto& pos2 = sidb_positions[j];
+
+                dist_mat(i, j) = std::hypot(pos1.first - pos2.first, pos1.second - pos2.second);
+            }
+        }
+
+        model.dist_mat = std::make_shared<const packed_symmetric_matrix<double>>(std::move(dist_mat));
+    }
+    /**
+     * Initializes the potential matrix between all the cells of the layout.
+     *
+     * @param model The model whose potential matrix is initialized. Its distance matrix has to be initialized.
+     */
+    void initialize_potential_matrix(charge_distribution_model& model) const noexcept
+    {
+        aligned_matrix<FloatType> pot_mat(this->num_cells(), this->num_cells(), 0);
+
+        for (uint64_t i = 0u; i < model.sidb_order.size(); ++i)
+        {
+            for (uint64_t j = 0u; j < model.sidb_order.size(); j++)
+            {
+                pot_mat[i][j] = static_cast<FloatType>(potential_between_sidbs_by_index(model, i, j));
+            }
+        }
+
+        model.pot_mat = std::make_shared<const aligned_matrix<FloatType>>(std::move(pot_mat));
+    }
+    /**
+     * Initializes the sparse potential matrix that only contains the potentials between SiDBs within the cutoff radius.
+     * To avoid comparing all pairs of SiDBs, they are sorted into a grid of square bins whose side length is the cutoff
+     * radius (cell lists). All SiDBs within the cutoff radius of an SiDB are then located in its own or one of the 8
+     * adjacent bins, which requires \f$ O(n \log n + m) \f$ time for \f$ m \f$ SiDB pairs within the cutoff radius.
+     *
+     * @param model The model whose sparse potential matrix is initialized. Its SiDB positions have to be initialized.
+     */
+    static void initialize_sparse_potential_matrix(charge_distribution_model& model) noexcept
+    {
+        using bin = std::pair<int64_t, int64_t>;
+
+        const auto& sidb_positions = *model.sidb_positions;
+
+        const auto num_sidbs = sidb_positions.size();
+        const auto cutoff    = model.phys_params.cutoff_radius;
+
+        const auto bin_of = [cutoff](const std::pair<double, double>& pos) noexcept
+        {
+            return bin{static_cast<int64_t>(std::floor(pos.first / cutoff)),
+                       static_cast<int64_t>(std::floor(pos.second / cutoff))};
+        };
+
+        // SiDB indices sorted by their bins such that all SiDBs of one bin can be found via binary search
+        std::vector<std::pair<bin, uint64_t>> bins{};
+        bins.reserve(num_sidbs);
+
+        for (uint64_t i = 0u; i < num_sidbs; ++i)
+        {
+            bins.emplace_back(bin_of(sidb_positions[i]), i);
+        }
+
+        std::sort(bins.begin(), bins.end());
+
+        csr_matrix<FloatType> sparse_pot_mat{};
+        sparse_pot_mat.reserve(num_sidbs, 0);
+
+        std::vector<std::pair<uint64_t, FloatType>> row{};
+
+        for (uint64_t i = 0u; i < num_sidbs; ++i)
+        {
+            row.clear();
+
+            const auto [bin_x, bin_y] = bin_of(sidb_positions[i]);
+
+            for (int64_t dx = -1; dx <= 1; ++dx)
+            {
+                for (int64_t dy = -1; dy <= 1; ++dy)
+                {
+                    const bin neighbor{bin_x + dx, bin_y + dy};
+
+                    const auto first =
+                        std::lower_bound(bins.cbegin(), bins.cend(), neighbor,
+                                         [](const auto& entry, const bin& b) { return entry.first < b; });
+
+                    for (auto it = first; it != bins.cend() && it->first == neighbor; ++it)
+                    {
+                        const auto j = it->second;
+
+                        if (j != i && distance_by_indices(model, i, j) <= cutoff)
+                        {
+                            row.emplace_back(j, static_cast<FloatType>(potential_between_sidbs_by_index(model, i, j)));
+                        }
+                    }
+                }
+            }
+
+            std::sort(row.begin(), row.end());
+
+            for (const auto& [j, potential] : row)
+            {
+                sparse_pot_mat.push_back(j, potential);
+            }
+
+            sparse_pot_mat.end_row();
+        }
+
+        model.sparse_pot_mat = std::make_shared<const csr_matrix<FloatType>>(std::move(sparse_pot_mat));
+    }
+    /**
+     * Gathers the distance and potential matrices as well as the external potential of the given model from the model
+     * of a layout that contains all of its SiDBs.
+     *
+     * @param model The model whose matrices are initialized.
+     * @param superset_model The model of a layout that contains all SiDBs of `model`.
+     */
+    static void initialize_matrices_from_superset(charge_distribution_model&       model,
+                                                  const charge_distribution_model& superset_model) noexcept
+    {
+        const auto num_sidbs = model.sidb_order.size();
+
+        std::vector<uint64_t> superset_indices(num_sidbs);
+
+        for (uint64_t i = 0u; i < num_sidbs; ++i)
+        {
+            const auto it =
+                std::find(superset_model.sidb_order.cbegin(), superset_model.sidb_order.cend(), model.sidb_order[i]);
+
+            assert(it != superset_model.sidb_order.cend() && "SiDB is not contained in the superset");
+
+            superset_indices[i] = static_cast<uint64_t>(std::distance(superset_model.sidb_order.cbegin(), it));
+        }
+
+        typename charge_distribution_model::position_vector sidb_positions{};
+        sidb_positions.reserve(num_sidbs);
+
+        for (const auto i : superset_indices)
+        {
+            sidb_positions.push_back((*superset_model.sidb_positions)[i]);
+        }
+
+        model.sidb_positions = std::make_shared<const typename charge_distribution_model::position_vector>(
+            std::move(sidb_positions));
+
+        model.external_charges.clear();
+
+        for (const auto& charge : superset_model.external_charges)
+        {
+            model.external_charges.push_back(charge);
+        }
+
+        model.external_pot.clear();
+
+        for (const auto i : superset_indices)
+        {
+            if (!superset_model.external_pot.empty())
+            {
+                model.external_pot.push_back(superset_model.external_pot[i]);
+            }
+        }
+
+        if (model.is_sparse())
+        {
+            initialize_sparse_potential_matrix_from_superset(model, superset_model, superset_indices);
+
+            return;
+        }
+
+        packed_symmetric_matrix<double> dist_mat(num_sidbs, 0);
+        aligned_matrix<FloatType>       pot_mat(num_sidbs, num_sidbs, 0);
+
+        for (uint64_t i = 0u; i < num_sidbs; ++i)
+        {
+            const auto* superset_row = (*superset_model.pot_mat)[superset_indices[i]];
+
+            for (uint64_t j = 0u; j < num_sidbs; ++j)
+            {
+                pot_mat[i][j] = superset_row[superset_indices[j]];
+            }
+
+            for (uint64_t j = i + 1; j < num_sidbs; ++j)
+            {
+                dist_mat(i, j) = (*superset_model.dist_mat)(superset_indices[i], superset_indices[j]);
+            }
+        }
+
+        model.dist_mat = std::make_shared<const packed_symmetric_matrix<double>>(std::move(dist_mat));
+        model.pot_mat  = std::make_shared<const aligned_matrix<FloatType>>(std::move(pot_mat));
+    }
+    /**
+     * Gathers the sparse potential matrix of the given model from the sparse potential matrix of a layout that contains
+     * all of its SiDBs.
+     *
+     * @param model The model whose sparse potential matrix is initialized.
+     * @param superset_model The model of a layout that contains all SiDBs of `model`.
+     * @param superset_indices The index of each SiDB of `model` in `superset_model`.
+     */
+    static void initialize_sparse_potential_matrix_from_superset(charge_distribution_model&       model,
+                                                                 const charge_distribution_model& superset_model,
+                                                                 const std::vector<uint64_t>&     superset_indices)
+    {
+        // maps each SiDB of the superset to its index in the subset or to -1 if it is not contained
+        std::vector<int64_t> subset_indices(superset_model.sidb_order.size(), -1);
+
+        for (uint64_t i = 0u; i < superset_indices.size(); ++i)
+        {
+            subset_indices[superset_indices[i]] = static_cast<int64_t>(i);
+        }
+
+        const auto& superset_mat = *superset_model.sparse_pot_mat;
+
+        csr_matrix<FloatType> sparse_pot_mat{};
+        sparse_pot_mat.reserve(superset_indices.size(), 0);
+
+        std::vector<std::pair<uint64_t, FloatType>> row{};
+
+        for (const auto superset_row : superset_indices)
+        {
+            row.clear();
+
+            const auto* cols = superset_mat.row_columns(superset_row);
+            const auto* vals = superset_mat.row_values(superset_row);
+
+            for (std::size_t k = 0; k < superset_mat.row_size(superset_row); ++k)
+            {
+                if (const auto j = subset_indices[cols[k]]; j != -1)
+                {
+                    row.emplace_back(static_cast<uint64_t>(j), vals[k]);
+                }
+            }
+
+            std::sort(row.begin(), row.end());
+
+            for (const auto& [j, potential] : row)
+            {
+                sparse_pot_mat.push_back(j, potential);
+            }
+
+            sparse_pot_mat.end_row();
+        }
+
+        model.sparse_pot_mat = std::make_shared<const csr_matrix<FloatType>>(std::move(sparse_pot_mat));
+    }
+    /**
+     * Initializes the maximum charge distribution index, i.e., \f$ b^n - 1 \f$ for \f$ n \f$ SiDBs and base \f$ b
+     * \f$.
+     */
+    void initialize_max_charge_index() noexcept
+    {
+        strg->max_charge_index = charge_distribution_index::power(strg->model->phys_params.base, this->num_cells());
+        strg->max_charge_index -= 1;
+    }
+    /**
+     * The electrostatic potential between two cells (SiDBs) is calculated based on the given model.
+     *
+     * @param model The model providing the distance matrix and the physical parameters.
+     * @param index1 The first index.
+     * @param index2 The second index.
+     * @return The potential between `index1` and `index2`.
+     */
+    [[nodiscard]] static double potential_between_sidbs_by_index(const charge_distribution_model& model,
+                                                                 const uint64_t index1, const uint64_t index2) noexcept
+    {
+        const auto distance = distance_by_indices(model, index1, index2);
+
+        if (distance == 0)
+        {
+            return 0.0;
+        }
+
+        return (model.phys_params.k / distance * std::exp(-distance / model.phys_params.lambda_tf) *
+                physical_constants::ELECTRIC_CHARGE);
+    }
+    /**
+     * Returns the distance between two SiDBs of the given model. If a cutoff radius is used, no distance matrix is
+     * stored and the distance is computed from the SiDB positions.
+     *
+     * @param model The model providing the distances or SiDB positions.
+     * @param index1 The first index.
+     * @param index2 The second index.
+     * @return The distance between `index1` and `index2`.
+     */
+    [[nodiscard]] static double distance_by_indices(const charge_distribution_model& model, const uint64_t index1,
+                                                    const uint64_t index2) noexcept
+    {
+        if (!model.is_sparse())
+        {
+            return (*model.dist_mat)(index1, index2);
+        }
+
+        if (index1 == index2)
+        {
+            return 0.0;
+        }
+
+        const auto& pos1 = (*model.sidb_positions)[index1];
+        const auto& pos2 = (*model.sidb_positions)[index2];
+
+        return std::hypot(pos1.first - pos2.first, pos1.second - pos2.second);
+    }
+    /**
+     * Returns the stored chargeless potential between two SiDBs of the given model, which is `0` for SiDBs farther
+     * apart than the cutoff radius if one is used.
+     *
+     * @param model The model providing the potentials.
+     * @param index1 The first index.
+     * @param index2 The second index.
+     * @return The potential between `index1` and `index2`.
+     */
+    [[nodiscard]] static double stored_potential_by_indices(const charge_distribution_model& model,
+                                                            const uint64_t index1, const uint64_t index2) noexcept
+    {
+        if (model.is_sparse())
+        {
+            return static_cast<double>((*model.sparse_pot_mat)(index1, index2));
+        }
+
+        return static_cast<double>((*model.pot_mat)[index1][index2]);
+    }
 };
 
 template <class T>
@@ -893,6 +1825,13 @@ charge_distribution_surface(const T&, const sidb_simulation_parameters&, const s
 template <class T>
 charge_distribution_surface(const T&, const sidb_simulation_parameters&) -> charge_distribution_surface<T>;
 
+template <class T>
+charge_distribution_surface(const T&, const charge_distribution_surface<T>&, const sidb_charge_state& cs)
+    -> charge_distribution_surface<T>;
+
+template <class T>
+charge_distribution_surface(const T&, const charge_distribution_surface<T>&) -> charge_distribution_surface<T>;
+
 }  // namespace fiction
 
 #endif  // FICTION_CHARGE_DISTRIBUTION_SURFACE_HPP
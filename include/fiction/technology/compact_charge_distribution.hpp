@@ -0,0 +1,324 @@
+#ifndef FICTION_COMPACT_CHARGE_DISTRIBUTION_HPP
+#define FICTION_COMPACT_CHARGE_DISTRIBUTION_HPP
+
+#include "fiction/technology/charge_distribution_index.hpp"
+#include "fiction/technology/charge_distribution_surface.hpp"
+#include "fiction/technology/sidb_charge_state.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Stores the charge states of an SiDB layout with two bits per SiDB.
+ */
+class packed_charge_distribution
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty charge distribution.
+     */
+    packed_charge_distribution() = default;
+    /**
+     * Packs the given charge states.
+     *
+     * @param charge_states Charge states of all SiDBs.
+     */
+    explicit packed_charge_distribution(const std::vector<sidb_charge_state>& charge_states) :
+            num_sidbs{charge_states.size()},
+            words((charge_states.size() + SIDBS_PER_WORD - 1) / SIDBS_PER_WORD, 0)
+    {
+        for (uint64_t i = 0; i < charge_states.size(); ++i)
+        {
+            assign_charge_state(i, charge_states[i]);
+        }
+    }
+    /**
+     * Returns the number of SiDBs.
+     *
+     * @return Number of SiDBs whose charge states are stored.
+     */
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+        return num_sidbs;
+    }
+    /**
+     * Returns the charge state of the SiDB with the given index.
+     *
+     * @param index Index of the SiDB.
+     * @return Charge state of the SiDB.
+     */
+    [[nodiscard]] sidb_charge_state get_charge_state(const uint64_t index) const noexcept
+    {
+        assert(index < num_sidbs && "Index out of range.");
+
+        return static_cast<sidb_charge_state>((words[index / SIDBS_PER_WORD] >> shift(index)) & MASK);
+    }
+    /**
+     * Assigns a charge state to the SiDB with the given index.
+     *
+     * @param index Index of the SiDB.
+     * @param cs Charge state to assign.
+     */
+    void assign_charge_state(const uint64_t index, const sidb_charge_state& cs) noexcept
+    {
+        assert(index < num_sidbs && "Index out of range.");
+
+        auto& word = words[index / SIDBS_PER_WORD];
+
+        word &= ~(MASK << shift(index));
+        word |= static_cast<uint64_t>(cs) << shift(index);
+    }
+    /**
+     * Unpacks the charge states of all SiDBs.
+     *
+     * @return Vector of the charge states of all SiDBs.
+     */
+    [[nodiscard]] std::vector<sidb_charge_state> get_all_charge_states() const noexcept
+    {
+        std::vector<sidb_charge_state> charge_states(num_sidbs);
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            charge_states[i] = get_charge_state(i);
+        }
+
+        return charge_states;
+    }
+
+    bool operator==(const packed_charge_distribution& other) const noexcept
+    {
+        return num_sidbs == other.num_sidbs && words == other.words;
+    }
+
+    bool operator!=(const packed_charge_distribution& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const packed_charge_distribution& other) const noexcept
+    {
+        return num_sidbs < other.num_sidbs || (num_sidbs == other.num_sidbs && words < other.words);
+    }
+
+  private:
+    /**
+     * Number of bits used per SiDB. They suffice to represent all values of `sidb_charge_state`.
+     */
+    static constexpr const uint64_t BITS_PER_SIDB = 2;
+    /**
+     * Number of SiDBs per word.
+     */
+    static constexpr const uint64_t SIDBS_PER_WORD = 64 / BITS_PER_SIDB;
+    /**
+     * Mask to extract the charge state of a single SiDB.
+     */
+    static constexpr const uint64_t MASK = (uint64_t{1} << BITS_PER_SIDB) - 1;
+    /**
+     * Number of SiDBs.
+     */
+    uint64_t num_sidbs{0};
+    /**
+     * Packed charge states.
+     */
+    std::vector<uint64_t> words{};
+
+    [[nodiscard]] static constexpr uint64_t shift(const uint64_t index) noexcept
+    {
+        return (index % SIDBS_PER_WORD) * BITS_PER_SIDB;
+    }
+};
+/**
+ * A memory-efficient collection of charge distributions of the same SiDB layout. Instead of storing a complete
+ * charge_distribution_surface per charge distribution, which includes the local potentials and further bookkeeping of
+ * each charge distribution, only the packed charge states, the system energy, and the validity are stored. All entries
+ * share one physical model, i.e., a charge_distribution_surface holding the layout and the physical parameters, from
+ * which full charge distribution surfaces can be materialized on demand.
+ *
+ * @tparam Lyt Cell-level layout type.
+ */
+template <typename Lyt>
+class compact_charge_distributions
+{
+  public:
+    /**
+     * A single compactly stored charge distribution.
+     */
+    struct entry
+    {
+        /**
+         * Charge states of all SiDBs.
+         */
+        packed_charge_distribution charges{};
+        /**
+         * Electrostatic potential energy of the charge distribution.
+         */
+        double system_energy{0.0};
+        /**
+         * Physical validity of the charge distribution.
+         */
+        bool validity{false};
+        /**
+         * Charge distribution index.
+         */
+        charge_distribution_index charge_index{};
+    };
+    /**
+     * Standard constructor. The physical model is determined by the first stored charge distribution.
+     */
+    compact_charge_distributions() = default;
+    /**
+     * Constructor for a given physical model that is shared with other collections.
+     *
+     * @param m Charge distribution surface that serves as the physical model.
+     */
+    explicit compact_charge_distributions(std::shared_ptr<const charge_distribution_surface<Lyt>> m) :
+            model{std::move(m)}
+    {}
+    /**
+     * Stores the given charge distribution. Unless specified on construction, the first stored charge distribution
+     * surface serves as the physical model of all subsequent ones, which must therefore be based on the same layout and
+     * physical parameters. The charge distribution index of `charge_lyt` is expected to be up to date.
+     *
+     * @param charge_lyt Charge distribution surface to store.
+     */
+    void add(const charge_distribution_surface<Lyt>& charge_lyt)
+    {
+        if (!model)
+        {
+            model = std::make_shared<const charge_distribution_surface<Lyt>>(charge_lyt);
+        }
+
+        assert(charge_lyt.num_cells() == model->num_cells() && "The charge distribution belongs to another layout.");
+
+        entries.push_back(entry{packed_charge_distribution{charge_lyt.get_all_sidb_charges()},
+                                charge_lyt.get_system_energy(), charge_lyt.is_physically_valid(),
+                                charge_lyt.get_charge_index().first});
+    }
+    /**
+     * Stores the given compactly stored charge distribution, which must belong to the physical model of this
+     * collection.
+     *
+     * @param e Compactly stored charge distribution.
+     */
+    void add(const entry& e)
+    {
+        assert(model && e.charges.size() == model->num_cells() && "The charge distribution belongs to another layout.");
+
+        entries.push_back(e);
+    }
+    /**
+     * Appends all charge distributions of another collection that shares the same physical model.
+     *
+     * @param other Collection to append.
+     */
+    void append(const compact_charge_distributions<Lyt>& other)
+    {
+        if (!model)
+        {
+            model = other.model;
+        }
+
+        entries.insert(entries.end(), other.entries.cbegin(), other.entries.cend());
+    }
+    /**
+     * Sorts the stored charge distributions in ascending order of their charge distribution index.
+     */
+    void sort_by_charge_index()
+    {
+        std::sort(entries.begin(), entries.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.charge_index < rhs.charge_index; });
+    }
+    /**
+     * Returns the number of stored charge distributions.
+     *
+     * @return Number of stored charge distributions.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return entries.size();
+    }
+    /**
+     * Checks whether no charge distribution is stored.
+     *
+     * @return `true` iff no charge distribution is stored.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return entries.empty();
+    }
+    /**
+     * Returns the stored charge distribution with the given index.
+     *
+     * @param index Index of the charge distribution.
+     * @return Compactly stored charge distribution.
+     */
+    [[nodiscard]] const entry& operator[](const std::size_t index) const noexcept
+    {
+        return entries[index];
+    }
+
+    [[nodiscard]] auto begin() const noexcept
+    {
+        return entries.cbegin();
+    }
+
+    [[nodiscard]] auto end() const noexcept
+    {
+        return entries.cend();
+    }
+    /**
+     * Returns the shared physical model.
+     *
+     * @return Charge distribution surface that serves as the physical model or `nullptr` if nothing was stored yet.
+     */
+    [[nodiscard]] std::shared_ptr<const charge_distribution_surface<Lyt>> get_model() const noexcept
+    {
+        return model;
+    }
+    /**
+     * Materializes the stored charge distribution with the given index into a full charge distribution surface whose
+     * local potentials, system energy, validity, and charge index are up to date.
+     *
+     * @param index Index of the charge distribution.
+     * @return Charge distribution surface representing the stored charge distribution.
+     */
+    [[nodiscard]] charge_distribution_surface<Lyt> materialize(const std::size_t index) const
+    {
+        assert(model && index < entries.size() && "Index out of range.");
+
+        charge_distribution_surface<Lyt> charge_lyt{*model};
+
+        const auto& charges = entries[index].charges;
+
+        for (uint64_t i = 0; i < charges.size(); ++i)
+        {
+            charge_lyt.assign_charge_state_by_cell_index(i, charges.get_charge_state(i), false);
+        }
+
+        charge_lyt.update_after_charge_change();
+        charge_lyt.charge_distribution_to_index();
+
+        return charge_lyt;
+    }
+
+  private:
+    /**
+     * Shared physical model.
+     */
+    std::shared_ptr<const charge_distribution_surface<Lyt>> model{nullptr};
+    /**
+     * Compactly stored charge distributions.
+     */
+    std::vector<entry> entries{};
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_COMPACT_CHARGE_DISTRIBUTION_HPP
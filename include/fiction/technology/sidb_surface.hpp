@@ -105,6 +105,15 @@ class sidb_surface<Lyt, false> : public Lyt
 
         assert(strg->params.ignore.count(sidb_defect_type::NONE) == 0 && "The defect type 'NONE' cannot be ignored");
     }
+    /**
+     * Returns the parameters of the surface.
+     *
+     * @return SiDB surface parameters.
+     */
+    [[nodiscard]] const sidb_surface_params& get_sidb_surface_parameters() const noexcept
+    {
+        return strg->params;
+    }
     /**
      * Assigns a given defect type to the given coordinate.
      *
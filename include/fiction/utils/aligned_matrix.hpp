@@ -0,0 +1,309 @@
+#ifndef FICTION_ALIGNED_MATRIX_HPP
+#define FICTION_ALIGNED_MATRIX_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Alignment in bytes of all data stored by `aligned_allocator`. 64 bytes correspond to the size of a cache line on
+ * most architectures as well as to the width of an AVX-512 register.
+ */
+inline constexpr const std::size_t CACHE_LINE_ALIGNMENT = 64;
+/**
+ * An allocator that aligns all allocated memory to `Alignment` bytes. It can be used with all STL containers.
+ *
+ * @tparam T Type of the elements to allocate.
+ * @tparam Alignment Alignment in bytes. Has to be a power of two.
+ */
+template <typename T, std::size_t Alignment = CACHE_LINE_ALIGNMENT>
+class aligned_allocator
+{
+  public:
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment is smaller than the natural alignment of T");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept  // NOLINT(google-explicit-constructor)
+    {}
+
+    [[nodiscard]] T* allocate(const std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* p, const std::size_t) noexcept
+    {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    bool operator==(const aligned_allocator<U, Alignment>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept
+    {
+        return false;
+    }
+};
+/**
+ * A `std::vector` whose data is aligned to the size of a cache line.
+ *
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+using aligned_vector = std::vector<T, aligned_allocator<T>>;
+/**
+ * A dense matrix that stores its elements contiguously in row-major order. In contrast to a vector of vectors, all
+ * elements are located in a single allocation. Rows are padded such that each of them starts at a cache line boundary,
+ * which allows for vectorized traversals of entire rows.
+ *
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+class aligned_matrix
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty matrix.
+     */
+    aligned_matrix() noexcept = default;
+    /**
+     * Creates a matrix of the given dimensions whose elements are all initialized with `value`.
+     *
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param value Initial value of all elements.
+     */
+    aligned_matrix(const std::size_t rows, const std::size_t cols, const T& value = T{}) :
+            num_rows{rows},
+            num_cols{cols},
+            row_stride{padded_size(cols)},
+            data(rows * row_stride, value)
+    {}
+    /**
+     * Returns the number of rows.
+     *
+     * @return Number of rows.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return num_rows;
+    }
+    /**
+     * Returns the number of columns.
+     *
+     * @return Number of columns.
+     */
+    [[nodiscard]] std::size_t columns() const noexcept
+    {
+        return num_cols;
+    }
+    /**
+     * Returns the distance in elements between the beginnings of two consecutive rows.
+     *
+     * @return Row stride including padding.
+     */
+    [[nodiscard]] std::size_t stride() const noexcept
+    {
+        return row_stride;
+    }
+    /**
+     * Returns a pointer to the beginning of the given row, which is aligned to a cache line boundary. This allows for
+     * the `m[i][j]` access syntax.
+     *
+     * @param row Row index.
+     * @return Pointer to the first element of the row.
+     */
+    [[nodiscard]] T* operator[](const std::size_t row) noexcept
+    {
+        assert(row < num_rows && "Row index out of range.");
+
+        return data.data() + row * row_stride;
+    }
+    /**
+     * Returns a pointer to the beginning of the given row, which is aligned to a cache line boundary. This allows for
+     * the `m[i][j]` access syntax.
+     *
+     * @param row Row index.
+     * @return Pointer to the first element of the row.
+     */
+    [[nodiscard]] const T* operator[](const std::size_t row) const noexcept
+    {
+        assert(row < num_rows && "Row index out of range.");
+
+        return data.data() + row * row_stride;
+    }
+    /**
+     * Returns the element at the given position.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Reference to the element.
+     */
+    [[nodiscard]] T& operator()(const std::size_t row, const std::size_t col) noexcept
+    {
+        assert(col < num_cols && "Column index out of range.");
+
+        return (*this)[row][col];
+    }
+    /**
+     * Returns the element at the given position.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Constant reference to the element.
+     */
+    [[nodiscard]] const T& operator()(const std::size_t row, const std::size_t col) const noexcept
+    {
+        assert(col < num_cols && "Column index out of range.");
+
+        return (*this)[row][col];
+    }
+
+  private:
+    /**
+     * Number of rows.
+     */
+    std::size_t num_rows{0};
+    /**
+     * Number of columns.
+     */
+    std::size_t num_cols{0};
+    /**
+     * Number of elements per row including padding.
+     */
+    std::size_t row_stride{0};
+    /**
+     * Contiguous element storage.
+     */
+    aligned_vector<T> data{};
+    /**
+     * Rounds the given number of elements up such that they occupy a multiple of the cache line size.
+     *
+     * @param n Number of elements.
+     * @return Padded number of elements.
+     */
+    [[nodiscard]] static constexpr std::size_t padded_size(const std::size_t n) noexcept
+    {
+        constexpr const std::size_t elements_per_line =
+            CACHE_LINE_ALIGNMENT % sizeof(T) == 0 ? CACHE_LINE_ALIGNMENT / sizeof(T) : 1;
+
+        return (n + elements_per_line - 1) / elements_per_line * elements_per_line;
+    }
+};
+/**
+ * A square symmetric matrix of which only the upper triangle including the diagonal is stored (packed storage). It
+ * requires about half the memory of a dense matrix but does not provide contiguous access to entire rows. Therefore,
+ * it is suited for matrices whose elements are only accessed individually.
+ *
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+class packed_symmetric_matrix
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty matrix.
+     */
+    packed_symmetric_matrix() noexcept = default;
+    /**
+     * Creates a `n x n` matrix whose elements are all initialized with `value`.
+     *
+     * @param n Number of rows and columns.
+     * @param value Initial value of all elements.
+     */
+    explicit packed_symmetric_matrix(const std::size_t n, const T& value = T{}) :
+            dimension{n},
+            data(n * (n + 1) / 2, value)
+    {}
+    /**
+     * Returns the number of rows (which equals the number of columns).
+     *
+     * @return Number of rows.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return dimension;
+    }
+    /**
+     * Returns the element at the given position. Since the matrix is symmetric, `m(i, j)` and `m(j, i)` refer to the
+     * same element.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Reference to the element.
+     */
+    [[nodiscard]] T& operator()(const std::size_t row, const std::size_t col) noexcept
+    {
+        return data[packed_index(row, col)];
+    }
+    /**
+     * Returns the element at the given position. Since the matrix is symmetric, `m(i, j)` and `m(j, i)` refer to the
+     * same element.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Constant reference to the element.
+     */
+    [[nodiscard]] const T& operator()(const std::size_t row, const std::size_t col) const noexcept
+    {
+        return data[packed_index(row, col)];
+    }
+
+  private:
+    /**
+     * Number of rows and columns.
+     */
+    std::size_t dimension{0};
+    /**
+     * Upper triangle stored row by row.
+     */
+    std::vector<T> data{};
+    /**
+     * Computes the position of the given element in the packed upper triangle.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Index into `data`.
+     */
+    [[nodiscard]] std::size_t packed_index(std::size_t row, std::size_t col) const noexcept
+    {
+        assert(row < dimension && col < dimension && "Index out of range.");
+
+        if (row > col)
+        {
+            std::swap(row, col);
+        }
+
+        return row * dimension - row * (row - 1) / 2 + (col - row);
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_ALIGNED_MATRIX_HPP
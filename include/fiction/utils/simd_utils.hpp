@@ -0,0 +1,426 @@
+#ifndef FICTION_SIMD_UTILS_HPP
+#define FICTION_SIMD_UTILS_HPP
+
+#include <cstddef>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace fiction
+{
+
+/**
+ * Name of the instruction set the vectorized kernels in this file were compiled for. The instruction set is selected
+ * at compile time based on the target architecture, e.g., by compiling with `-march=native` (see the CMake option
+ * `FICTION_ENABLE_NATIVE_ARCHITECTURE`). If neither AVX-512 nor AVX2 is available, scalar fallbacks are used.
+ */
+#if defined(__AVX512F__)
+inline constexpr const char* SIMD_INSTRUCTION_SET = "AVX-512";
+#elif defined(__AVX2__)
+inline constexpr const char* SIMD_INSTRUCTION_SET = "AVX2";
+#else
+inline constexpr const char* SIMD_INSTRUCTION_SET = "scalar";
+#endif
+
+namespace detail
+{
+
+#if defined(__AVX2__) && !defined(__AVX512F__)
+/**
+ * Computes `a * b + c` element-wise, fused if the target supports FMA.
+ */
+inline __m256d fmadd(const __m256d a, const __m256d b, const __m256d c) noexcept
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
+/**
+ * Sums up the four elements of the given register.
+ */
+inline double horizontal_sum(const __m256d v) noexcept
+{
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+/**
+ * Computes `a * b + c` element-wise in single precision, fused if the target supports FMA.
+ */
+inline __m256 fmadd(const __m256 a, const __m256 b, const __m256 c) noexcept
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+/**
+ * Sums up the eight elements of the given register.
+ */
+inline float horizontal_sum(const __m256 v) noexcept
+{
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum        = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+
+    return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x1)));
+}
+#endif
+
+}  // namespace detail
+
+/**
+ * Computes the dot product \f$ \sum_{i=0}^{n-1} a_i \cdot b_i \f$ of two arrays. The arrays do not have to be aligned,
+ * but aligned arrays (see `aligned_vector` and `aligned_matrix`) allow for faster loads.
+ *
+ * @param a First array.
+ * @param b Second array.
+ * @param n Number of elements of both arrays.
+ * @return Dot product of `a` and `b`.
+ */
+[[nodiscard]] inline double dot_product(const double* a, const double* b, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512F__)
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+
+    for (; i + 16 <= n; i += 16)
+    {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8), acc1);
+    }
+    for (; i < n; i += 8)
+    {
+        const auto mask = static_cast<__mmask8>(n - i >= 8 ? 0xFFu : (1u << (n - i)) - 1);
+        acc0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i), acc0);
+    }
+
+    return _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+#else
+    double sum = 0.0;
+
+#if defined(__AVX2__)
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = detail::fmadd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), acc0);
+        acc1 = detail::fmadd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), acc1);
+    }
+
+    sum = detail::horizontal_sum(_mm256_add_pd(acc0, acc1));
+#endif
+
+    for (; i < n; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+#endif
+}
+/**
+ * Adds a scaled array to another one, i.e., \f$ y_i \leftarrow y_i + \alpha \cdot x_i \f$ for all \f$ 0 \leq i < n
+ * \f$.
+ *
+ * @param y Array to which the scaled array is added.
+ * @param x Array to scale.
+ * @param alpha Scaling factor.
+ * @param n Number of elements of both arrays.
+ */
+inline void scaled_add(double* y, const double* x, const double alpha, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512F__)
+    const __m512d factor = _mm512_set1_pd(alpha);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(factor, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    }
+    if (i < n)
+    {
+        const auto mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+        _mm512_mask_storeu_pd(
+            y + i, mask,
+            _mm512_fmadd_pd(factor, _mm512_maskz_loadu_pd(mask, x + i), _mm512_maskz_loadu_pd(mask, y + i)));
+    }
+#else
+#if defined(__AVX2__)
+    const __m256d factor = _mm256_set1_pd(alpha);
+
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(y + i, detail::fmadd(factor, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+#endif
+}
+/**
+ * Checks whether an index \f$ j \f$ exists for which both \f$ s_j > s \f$ and \f$ \delta \cdot (v - x_j) - r_j < t \f$
+ * hold. In the context of SiDB simulation, \f$ s \f$ are the charge signs, \f$ x \f$ the local potentials, and \f$ r
+ * \f$ one row of the potential matrix such that the function detects whether an energetically favorable hop of a charge
+ * from the SiDB described by \f$ s \f$, \f$ v \f$, and \f$ \delta \f$ to any other SiDB exists.
+ *
+ * @param r Array \f$ r \f$.
+ * @param x Array \f$ x \f$.
+ * @param signs Array \f$ s \f$.
+ * @param n Number of elements of all arrays.
+ * @param sign Value \f$ s \f$ that has to be exceeded by \f$ s_j \f$.
+ * @param value Value \f$ v \f$.
+ * @param delta Factor \f$ \delta \f$.
+ * @param threshold Threshold \f$ t \f$.
+ * @return `true` iff at least one index fulfills both conditions.
+ */
+[[nodiscard]] inline bool any_hop_below_threshold(const double* r, const double* x, const double* signs,
+                                                  const std::size_t n, const double sign, const double value,
+                                                  const double delta, const double threshold) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512F__)
+    const __m512d s_vec = _mm512_set1_pd(sign);
+    const __m512d v_vec = _mm512_set1_pd(value);
+    const __m512d d_vec = _mm512_set1_pd(delta);
+    const __m512d t_vec = _mm512_set1_pd(threshold);
+
+    for (; i < n; i += 8)
+    {
+        const auto load_mask = static_cast<__mmask8>(n - i >= 8 ? 0xFFu : (1u << (n - i)) - 1);
+
+        const __m512d e = _mm512_fmsub_pd(d_vec, _mm512_sub_pd(v_vec, _mm512_maskz_loadu_pd(load_mask, x + i)),
+                                          _mm512_maskz_loadu_pd(load_mask, r + i));
+
+        const __mmask8 hops = _mm512_mask_cmp_pd_mask(load_mask, _mm512_maskz_loadu_pd(load_mask, signs + i), s_vec,
+                                                      _CMP_GT_OQ) &
+                              _mm512_cmp_pd_mask(e, t_vec, _CMP_LT_OQ);
+
+        if (hops != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+#else
+#if defined(__AVX2__)
+    const __m256d s_vec = _mm256_set1_pd(sign);
+    const __m256d v_vec = _mm256_set1_pd(value);
+    const __m256d d_vec = _mm256_set1_pd(delta);
+    const __m256d t_vec = _mm256_set1_pd(threshold);
+
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d e = _mm256_sub_pd(_mm256_mul_pd(d_vec, _mm256_sub_pd(v_vec, _mm256_loadu_pd(x + i))),
+                                        _mm256_loadu_pd(r + i));
+
+        const __m256d hops = _mm256_and_pd(_mm256_cmp_pd(_mm256_loadu_pd(signs + i), s_vec, _CMP_GT_OQ),
+                                           _mm256_cmp_pd(e, t_vec, _CMP_LT_OQ));
+
+        if (_mm256_movemask_pd(hops) != 0)
+        {
+            return true;
+        }
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        if (signs[i] > sign && delta * (value - x[i]) - r[i] < threshold)
+        {
+            return true;
+        }
+    }
+
+    return false;
+#endif
+}
+
+/**
+ * Computes the dot product \f$ \sum_{i=0}^{n-1} a_i \cdot b_i \f$ of two single-precision arrays. Each register
+ * holds twice as many elements as in double precision.
+ *
+ * @param a First array.
+ * @param b Second array.
+ * @param n Number of elements of both arrays.
+ * @return Dot product of `a` and `b`.
+ */
+[[nodiscard]] inline float dot_product(const float* a, const float* b, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512F__)
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+
+    for (; i + 32 <= n; i += 32)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), acc1);
+    }
+    for (; i < n; i += 16)
+    {
+        const auto mask = static_cast<__mmask16>(n - i >= 16 ? 0xFFFFu : (1u << (n - i)) - 1);
+        acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), acc0);
+    }
+
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+#else
+    float sum = 0.0f;
+
+#if defined(__AVX2__)
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+
+    for (; i + 16 <= n; i += 16)
+    {
+        acc0 = detail::fmadd(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = detail::fmadd(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+
+    sum = detail::horizontal_sum(_mm256_add_ps(acc0, acc1));
+#endif
+
+    for (; i < n; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+#endif
+}
+/**
+ * Adds a scaled single-precision array to another one, i.e., \f$ y_i \leftarrow y_i + \alpha \cdot x_i \f$ for all
+ * \f$ 0 \leq i < n \f$.
+ *
+ * @param y Array to which the scaled array is added.
+ * @param x Array to scale.
+ * @param alpha Scaling factor.
+ * @param n Number of elements of both arrays.
+ */
+inline void scaled_add(float* y, const float* x, const float alpha, const std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512F__)
+    const __m512 factor = _mm512_set1_ps(alpha);
+
+    for (; i + 16 <= n; i += 16)
+    {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(factor, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < n)
+    {
+        const auto mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+        _mm512_mask_storeu_ps(
+            y + i, mask,
+            _mm512_fmadd_ps(factor, _mm512_maskz_loadu_ps(mask, x + i), _mm512_maskz_loadu_ps(mask, y + i)));
+    }
+#else
+#if defined(__AVX2__)
+    const __m256 factor = _mm256_set1_ps(alpha);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm256_storeu_ps(y + i, detail::fmadd(factor, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+#endif
+}
+/**
+ * Single-precision variant of `any_hop_below_threshold` that checks twice as many SiDBs per instruction.
+ *
+ * @param r Array \f$ r \f$.
+ * @param x Array \f$ x \f$.
+ * @param signs Array \f$ s \f$.
+ * @param n Number of elements of all arrays.
+ * @param sign Value \f$ s \f$ that has to be exceeded by \f$ s_j \f$.
+ * @param value Value \f$ v \f$.
+ * @param delta Factor \f$ \delta \f$.
+ * @param threshold Threshold \f$ t \f$.
+ * @return `true` iff at least one index fulfills both conditions.
+ */
+[[nodiscard]] inline bool any_hop_below_threshold(const float* r, const float* x, const float* signs,
+                                                  const std::size_t n, const float sign, const float value,
+                                                  const float delta, const float threshold) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512F__)
+    const __m512 s_vec = _mm512_set1_ps(sign);
+    const __m512 v_vec = _mm512_set1_ps(value);
+    const __m512 d_vec = _mm512_set1_ps(delta);
+    const __m512 t_vec = _mm512_set1_ps(threshold);
+
+    for (; i < n; i += 16)
+    {
+        const auto load_mask = static_cast<__mmask16>(n - i >= 16 ? 0xFFFFu : (1u << (n - i)) - 1);
+
+        const __m512 e = _mm512_fmsub_ps(d_vec, _mm512_sub_ps(v_vec, _mm512_maskz_loadu_ps(load_mask, x + i)),
+                                         _mm512_maskz_loadu_ps(load_mask, r + i));
+
+        const __mmask16 hops = _mm512_mask_cmp_ps_mask(load_mask, _mm512_maskz_loadu_ps(load_mask, signs + i), s_vec,
+                                                       _CMP_GT_OQ) &
+                               _mm512_cmp_ps_mask(e, t_vec, _CMP_LT_OQ);
+
+        if (hops != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+#else
+#if defined(__AVX2__)
+    const __m256 s_vec = _mm256_set1_ps(sign);
+    const __m256 v_vec = _mm256_set1_ps(value);
+    const __m256 d_vec = _mm256_set1_ps(delta);
+    const __m256 t_vec = _mm256_set1_ps(threshold);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 e = _mm256_sub_ps(_mm256_mul_ps(d_vec, _mm256_sub_ps(v_vec, _mm256_loadu_ps(x + i))),
+                                       _mm256_loadu_ps(r + i));
+
+        const __m256 hops = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(signs + i), s_vec, _CMP_GT_OQ),
+                                          _mm256_cmp_ps(e, t_vec, _CMP_LT_OQ));
+
+        if (_mm256_movemask_ps(hops) != 0)
+        {
+            return true;
+        }
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        if (signs[i] > sign && delta * (value - x[i]) - r[i] < threshold)
+        {
+            return true;
+        }
+    }
+
+    return false;
+#endif
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_SIMD_UTILS_HPP
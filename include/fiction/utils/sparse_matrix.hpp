@@ -0,0 +1,193 @@
+#ifndef FICTION_SPARSE_MATRIX_HPP
+#define FICTION_SPARSE_MATRIX_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * A sparse matrix in compressed sparse row (CSR) format. Only the non-zero elements are stored row by row together with
+ * their column indices, which are sorted in ascending order within each row. It is suited for matrices of which each
+ * row contains only few non-zero elements, e.g., the potentials between SiDBs within a cutoff radius.
+ *
+ * The matrix is constructed row by row via `push_back` and `end_row`.
+ *
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+class csr_matrix
+{
+  public:
+    /**
+     * Standard constructor. Creates an empty matrix without any rows.
+     */
+    csr_matrix() noexcept = default;
+    /**
+     * Appends an element to the current row. Elements have to be appended in ascending order of their column indices.
+     *
+     * @param col Column index.
+     * @param value Value of the element.
+     */
+    void push_back(const uint64_t col, const T& value)
+    {
+        assert((row_offsets.back() == columns.size() || columns.back() < col) &&
+               "Column indices have to be appended in ascending order.");
+
+        columns.push_back(col);
+        values.push_back(value);
+    }
+    /**
+     * Completes the current row. Subsequently appended elements belong to the next row.
+     */
+    void end_row()
+    {
+        row_offsets.push_back(columns.size());
+    }
+    /**
+     * Reserves memory for the given number of rows and non-zero elements.
+     *
+     * @param rows Number of rows.
+     * @param non_zeros Number of non-zero elements.
+     */
+    void reserve(const std::size_t rows, const std::size_t non_zeros)
+    {
+        row_offsets.reserve(rows + 1);
+        columns.reserve(non_zeros);
+        values.reserve(non_zeros);
+    }
+    /**
+     * Returns the number of completed rows.
+     *
+     * @return Number of rows.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return row_offsets.size() - 1;
+    }
+    /**
+     * Returns the number of stored (non-zero) elements.
+     *
+     * @return Number of stored elements.
+     */
+    [[nodiscard]] std::size_t num_non_zeros() const noexcept
+    {
+        return values.size();
+    }
+    /**
+     * Returns the number of stored elements of the given row.
+     *
+     * @param row Row index.
+     * @return Number of stored elements of `row`.
+     */
+    [[nodiscard]] std::size_t row_size(const std::size_t row) const noexcept
+    {
+        assert(row < size() && "Row index out of range.");
+
+        return static_cast<std::size_t>(row_offsets[row + 1] - row_offsets[row]);
+    }
+    /**
+     * Returns a pointer to the column indices of the given row.
+     *
+     * @param row Row index.
+     * @return Pointer to the first column index of `row`.
+     */
+    [[nodiscard]] const uint64_t* row_columns(const std::size_t row) const noexcept
+    {
+        assert(row < size() && "Row index out of range.");
+
+        return columns.data() + row_offsets[row];
+    }
+    /**
+     * Returns a pointer to the values of the given row.
+     *
+     * @param row Row index.
+     * @return Pointer to the first value of `row`.
+     */
+    [[nodiscard]] const T* row_values(const std::size_t row) const noexcept
+    {
+        assert(row < size() && "Row index out of range.");
+
+        return values.data() + row_offsets[row];
+    }
+    /**
+     * Returns the element at the given position. Since the column indices of each row are sorted, the element is found
+     * via binary search.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Value of the element or `T{}` if it is not stored.
+     */
+    [[nodiscard]] T operator()(const std::size_t row, const std::size_t col) const noexcept
+    {
+        const auto* first = row_columns(row);
+        const auto* last  = first + row_size(row);
+
+        if (const auto* it = std::lower_bound(first, last, col); it != last && *it == col)
+        {
+            return row_values(row)[it - first];
+        }
+
+        return T{};
+    }
+    /**
+     * Computes the dot product of the given row with a dense vector, i.e., \f$ \sum_j m_{row,j} \cdot x_j \f$.
+     *
+     * @param row Row index.
+     * @param x Dense vector with at least as many elements as the matrix has columns.
+     * @return Dot product of `row` and `x`.
+     */
+    [[nodiscard]] T dot_row(const std::size_t row, const T* x) const noexcept
+    {
+        const auto* cols = row_columns(row);
+        const auto* vals = row_values(row);
+
+        T sum{};
+
+        for (std::size_t k = 0; k < row_size(row); ++k)
+        {
+            sum += vals[k] * x[cols[k]];
+        }
+
+        return sum;
+    }
+    /**
+     * Adds the scaled given row to a dense vector, i.e., \f$ y_j \leftarrow y_j + \alpha \cdot m_{row,j} \f$.
+     *
+     * @param row Row index.
+     * @param alpha Scaling factor.
+     * @param y Dense vector with at least as many elements as the matrix has columns.
+     */
+    void scaled_add_row(const std::size_t row, const T& alpha, T* y) const noexcept
+    {
+        const auto* cols = row_columns(row);
+        const auto* vals = row_values(row);
+
+        for (std::size_t k = 0; k < row_size(row); ++k)
+        {
+            y[cols[k]] += alpha * vals[k];
+        }
+    }
+
+  private:
+    /**
+     * Offsets of the rows' first elements in `columns` and `values`. The last entry marks the end of the last row.
+     */
+    std::vector<uint64_t> row_offsets{0};
+    /**
+     * Column indices of all stored elements.
+     */
+    std::vector<uint64_t> columns{};
+    /**
+     * Values of all stored elements.
+     */
+    std::vector<T> values{};
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SPARSE_MATRIX_HPP
@@ -10,6 +10,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <random>
 
@@ -171,6 +172,41 @@ TEST_CASE("Simulated Annealing for optimizing the 1D Schwefel function", "[sim-a
                   << std::endl;
     }
 }
+TEST_CASE("Simulated Annealing with a given random number generator", "[sim-anneal]")
+{
+    constexpr const auto init_state = 0.0;
+
+    const auto anneal = [](const uint64_t seed)
+    {
+        constexpr const auto init_temp  = 5000.0;
+        constexpr const auto final_temp = 1.0;
+        constexpr const auto cycles     = 10u;
+
+        std::mt19937_64 generator{seed};
+
+        // draws the adjacent states from the same generator as the acceptance probabilities
+        const auto next = [&generator](const double& x)
+        {
+            std::uniform_real_distribution<double> distribution{x - 100, x + 100};
+
+            return std::clamp(distribution(generator), -500.0, 500.0);
+        };
+
+        return simulated_annealing(0.0, init_temp, final_temp, cycles, schwefel_function_1d,
+                                   geometric_temperature_schedule, next, generator);
+    };
+
+    const auto [result, cost] = anneal(42);
+
+    CHECK(cost < schwefel_function_1d(init_state));
+    CHECK_THAT(schwefel_function_1d(result), Catch::Matchers::WithinAbs(cost, 0.00001));
+
+    // the same seed yields the same result
+    const auto [repeated_result, repeated_cost] = anneal(42);
+
+    CHECK(repeated_result == result);
+    CHECK(repeated_cost == cost);
+}
 TEST_CASE("Simulated Annealing for optimizing the 2D Drop-Wave function", "[sim-anneal]")
 {
     constexpr const auto init_state = std::pair{2.5, -2.5};
@@ -11,6 +11,7 @@
 
 #include <fiction/algorithms/physical_design/apply_gate_library.hpp>
 #include <fiction/algorithms/physical_design/exact.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
 #include <fiction/algorithms/properties/critical_path_length_and_throughput.hpp>
 #include <fiction/algorithms/verification/design_rule_violations.hpp>
 #include <fiction/networks/technology_network.hpp>
@@ -187,6 +188,14 @@ exact_physical_design_params<Lyt>&& async(const std::size_t t, exact_physical_de
     return std::move(ps);
 }
 
+template <typename Lyt>
+exact_physical_design_params<Lyt>&& portfolio(const std::size_t n, exact_physical_design_params<Lyt>&& ps) noexcept
+{
+    ps.portfolio_size = n;
+
+    return std::move(ps);
+}
+
 template <typename Lyt>
 exact_physical_design_params<Lyt>&& minimize_wires(exact_physical_design_params<Lyt>&& ps) noexcept
 {
@@ -203,6 +212,14 @@ exact_physical_design_params<Lyt>&& minimize_crossings(exact_physical_design_par
     return std::move(ps);
 }
 
+template <typename Lyt>
+exact_physical_design_params<Lyt>&& anytime(exact_physical_design_params<Lyt>&& ps) noexcept
+{
+    ps.anytime = true;
+
+    return std::move(ps);
+}
+
 void check_stats(const exact_physical_design_stats& st)
 {
     CHECK(std::chrono::duration_cast<std::chrono::milliseconds>(st.time_total).count() > 0);
@@ -447,12 +464,15 @@ TEST_CASE("Exact Cartesian physical design", "[exact]")
                    !(lyt.has_northern_incoming_signal({2, 2}) && lyt.has_southern_outgoing_signal({2, 2}))));
         }
     }
-    //    SECTION("Asynchronicity")
-    //    {
-    //        check_with_gate_library<qca_cell_clk_lyt, qca_one_library>(
-    //            blueprints::unbalanced_and_inv_network<mockturtle::aig_network>(),
-    //            twoddwave(crossings(border_io(async(2, configuration<cart_gate_clk_lyt>())))));
-    //    }
+    SECTION("Asynchronicity")
+    {
+        check_with_gate_library<qca_cell_clk_lyt, qca_one_library>(
+            blueprints::unbalanced_and_inv_network<mockturtle::aig_network>(),
+            twoddwave(crossings(border_io(async(2, configuration<cart_gate_clk_lyt>())))));
+        check_with_gate_library<qca_cell_clk_lyt, qca_one_library>(
+            blueprints::unbalanced_and_inv_network<mockturtle::aig_network>(),
+            use(crossings(async(8, configuration<cart_gate_clk_lyt>()))));
+    }
     SECTION("Synchronization elements")
     {
         //            CHECK(generate_layout<cart_gate_clk_lyt>(blueprints::one_to_five_path_difference_network<technology_network>(),
@@ -675,6 +695,167 @@ TEST_CASE("Exact physical design timeout", "[exact]")
     CHECK(!layout.has_value());
 }
 
+TEST_CASE("Anytime exact physical design", "[exact]")
+{
+    const auto half_adder = blueprints::half_adder_network<mockturtle::aig_network>();
+
+    SECTION("timeout")
+    {
+        auto anytime_config    = anytime(twoddwave(crossings(desynchronize(configuration<cart_gate_clk_lyt>()))));
+        anytime_config.timeout = 1u;
+
+        const auto orthogonal_layout = orthogonal<cart_gate_clk_lyt>(half_adder);
+
+        exact_physical_design_stats stats{};
+        const auto                  layout = exact<cart_gate_clk_lyt>(half_adder, anytime_config, &stats);
+
+        // instead of std::nullopt, a layout that is at most as large as the orthogonal one is returned
+        REQUIRE(layout.has_value());
+
+        check_eq(half_adder, *layout);
+
+        CHECK(stats.x_size * stats.y_size <= (orthogonal_layout.x() + 1) * (orthogonal_layout.y() + 1));
+    }
+    SECTION("minimal upper bound")
+    {
+        const auto mux            = blueprints::mux21_network<mockturtle::aig_network>();
+        const auto minimal_layout = generate_layout(mux, twoddwave(configuration<cart_gate_clk_lyt>()));
+
+        auto anytime_config               = anytime(twoddwave(configuration<cart_gate_clk_lyt>()));
+        anytime_config.upper_bound_layout = minimal_layout;
+
+        exact_physical_design_stats stats{};
+        const auto                  layout = exact<cart_gate_clk_lyt>(mux, anytime_config, &stats);
+
+        REQUIRE(layout.has_value());
+
+        // no smaller layout exists; hence, the upper bound is returned
+        CHECK(stats.upper_bound_layout_returned);
+        CHECK(stats.x_size == minimal_layout.x() + 1);
+        CHECK(stats.y_size == minimal_layout.y() + 1);
+    }
+    SECTION("inapplicable orthogonal upper bound")
+    {
+        auto anytime_config    = anytime(use(crossings(configuration<cart_gate_clk_lyt>())));
+        anytime_config.timeout = 1u;
+
+        // the orthogonal algorithm does not support USE clocking
+        CHECK(!exact<cart_gate_clk_lyt>(half_adder, anytime_config).has_value());
+    }
+    SECTION("orthogonal upper bound violating the constraints")
+    {
+        auto anytime_config    = anytime(twoddwave(crossings(desynchronize(configuration<cart_gate_clk_lyt>()))));
+        anytime_config.timeout = 1u;
+
+        const auto orthogonal_layout = orthogonal<cart_gate_clk_lyt>(half_adder);
+
+        // the orthogonal layout does not satisfy the requested constraints; hence, no layout is returned
+        SECTION("balancing")
+        {
+            anytime_config.desynchronize = false;
+        }
+        SECTION("border I/Os")
+        {
+            anytime_config.border_io = true;
+        }
+        SECTION("straight inverters")
+        {
+            anytime_config.straight_inverters = true;
+        }
+        SECTION("fixed size")
+        {
+            anytime_config.fixed_size    = true;
+            anytime_config.upper_bound_x = static_cast<uint16_t>(orthogonal_layout.x() + 1);
+            anytime_config.upper_bound_y = static_cast<uint16_t>(orthogonal_layout.y() + 1);
+        }
+        SECTION("upper bound in x-direction")
+        {
+            anytime_config.upper_bound_x = static_cast<uint16_t>(orthogonal_layout.x());
+        }
+        SECTION("upper bound in y-direction")
+        {
+            anytime_config.upper_bound_y = static_cast<uint16_t>(orthogonal_layout.y());
+        }
+
+        CHECK(!exact<cart_gate_clk_lyt>(half_adder, anytime_config).has_value());
+    }
+}
+
+TEST_CASE("Minimum layout size of exact physical design", "[exact]")
+{
+    // the fan-out node and both inverters can only be placed at a sufficient distance from the north-western corner
+    const auto inv = blueprints::inverter_network<technology_network>();
+
+    exact_physical_design_stats stats{};
+    const auto layout = exact<cart_gate_clk_lyt>(inv, async(1, twoddwave(configuration<cart_gate_clk_lyt>())), &stats);
+
+    REQUIRE(layout.has_value());
+
+    check_eq(inv, *layout);
+
+    // 6 nodes, one of which has two fan-outs, fit into 4 x 2 tiles at best
+    CHECK(stats.x_size * stats.y_size == 8);
+}
+
+TEST_CASE("Exact physical design with several threads", "[exact]")
+{
+    const auto mux = blueprints::mux21_network<mockturtle::aig_network>();
+
+    exact_physical_design_stats serial_stats{};
+    const auto serial_layout = exact<cart_gate_clk_lyt>(mux, async(1, twoddwave(configuration<cart_gate_clk_lyt>())),
+                                                        &serial_stats);
+
+    REQUIRE(serial_layout.has_value());
+
+    for (const auto t : {2u, 4u, 16u})
+    {
+        exact_physical_design_stats parallel_stats{};
+        const auto                  parallel_layout =
+            exact<cart_gate_clk_lyt>(mux, async(t, twoddwave(configuration<cart_gate_clk_lyt>())), &parallel_stats);
+
+        REQUIRE(parallel_layout.has_value());
+
+        check_eq(mux, *parallel_layout);
+
+        // the smallest aspect ratio is found regardless of the number of threads
+        CHECK(parallel_stats.x_size == serial_stats.x_size);
+        CHECK(parallel_stats.y_size == serial_stats.y_size);
+        CHECK(parallel_stats.num_aspect_ratios == serial_stats.num_aspect_ratios);
+    }
+}
+
+TEST_CASE("Exact physical design with a solver portfolio", "[exact]")
+{
+    const auto and_or = blueprints::and_or_network<mockturtle::mig_network>();
+
+    exact_physical_design_stats default_stats{};
+    const auto                  default_layout =
+        exact<cart_gate_clk_lyt>(and_or, async(1, use(crossings(configuration<cart_gate_clk_lyt>()))), &default_stats);
+
+    REQUIRE(default_layout.has_value());
+
+    SECTION("single thread")
+    {
+        exact_physical_design_stats portfolio_stats{};
+        const auto                  portfolio_layout = exact<cart_gate_clk_lyt>(
+            and_or, portfolio(4, async(1, use(crossings(configuration<cart_gate_clk_lyt>())))), &portfolio_stats);
+
+        REQUIRE(portfolio_layout.has_value());
+
+        check_eq(and_or, *portfolio_layout);
+
+        // the first conclusive answer is a correct one, no matter which solver gives it
+        CHECK(portfolio_stats.x_size == default_stats.x_size);
+        CHECK(portfolio_stats.y_size == default_stats.y_size);
+        CHECK(portfolio_stats.num_aspect_ratios == default_stats.num_aspect_ratios);
+    }
+    SECTION("several threads")
+    {
+        check_with_gate_library<qca_cell_clk_lyt, qca_one_library>(
+            and_or, portfolio(3, async(2, use(crossings(configuration<cart_gate_clk_lyt>())))));
+    }
+}
+
 TEST_CASE("Name conservation after exact physical design", "[exact]")
 {
     auto maj = blueprints::maj1_network<mockturtle::names_view<mockturtle::mig_network>>();
@@ -0,0 +1,222 @@
+#include <catch2/catch_test_macros.hpp>
+
+#if (FICTION_Z3_SOLVER)
+
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/algorithms/physical_design/exact.hpp>
+#include <fiction/algorithms/physical_design/exact_physical_design_cache.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <utility>
+
+using namespace fiction;
+
+template <typename Lyt>
+void check_identical_layouts(const Lyt& expected, const Lyt& actual)
+{
+    CHECK(actual.x() == expected.x());
+    CHECK(actual.y() == expected.y());
+    CHECK(actual.z() == expected.z());
+    CHECK(actual.num_gates() == expected.num_gates());
+    CHECK(actual.num_wires() == expected.num_wires());
+    CHECK(actual.get_layout_name() == expected.get_layout_name());
+
+    REQUIRE(actual.num_pis() == expected.num_pis());
+    REQUIRE(actual.num_pos() == expected.num_pos());
+
+    for (uint32_t i = 0; i < expected.num_pis(); ++i)
+    {
+        CHECK(actual.get_input_name(i) == expected.get_input_name(i));
+    }
+    for (uint32_t i = 0; i < expected.num_pos(); ++i)
+    {
+        CHECK(actual.get_output_name(i) == expected.get_output_name(i));
+    }
+
+    expected.foreach_node(
+        [&expected, &actual](const auto& n)
+        {
+            if (expected.is_constant(n))
+            {
+                return;
+            }
+
+            const auto t = expected.get_tile(n);
+
+            CHECK(actual.node_function(actual.get_node(t)) == expected.node_function(n));
+            CHECK(actual.incoming_data_flow(t) == expected.incoming_data_flow(t));
+        });
+}
+
+TEST_CASE("Exact physical design cache", "[exact]")
+{
+    const auto mux = blueprints::mux21_network<mockturtle::aig_network>();
+
+    const exact_physical_design_params<cart_gate_clk_lyt> ps{};
+
+    exact_physical_design_cache cache{};
+
+    exact_physical_design_stats miss_stats{};
+    const auto                  miss_layout = cached_exact<cart_gate_clk_lyt>(mux, ps, cache, &miss_stats);
+
+    REQUIRE(miss_layout.has_value());
+
+    check_eq(mux, *miss_layout);
+
+    CHECK(miss_stats.optimal);
+    CHECK(cache.misses() == 1);
+    CHECK(cache.size() == 1);
+
+    SECTION("in memory")
+    {
+        exact_physical_design_stats hit_stats{};
+        const auto                  hit_layout = cached_exact<cart_gate_clk_lyt>(mux, ps, cache, &hit_stats);
+
+        REQUIRE(hit_layout.has_value());
+
+        check_eq(mux, *hit_layout);
+        check_identical_layouts(*miss_layout, *hit_layout);
+
+        CHECK(cache.hits() == 1);
+        CHECK(hit_stats.x_size == miss_stats.x_size);
+        CHECK(hit_stats.y_size == miss_stats.y_size);
+        CHECK(hit_stats.num_aspect_ratios == 0);
+    }
+    SECTION("on disk")
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "fiction_exact_physical_design_cache_test";
+        std::filesystem::remove_all(directory);
+
+        {
+            exact_physical_design_cache disk_cache{exact_physical_design_cache_params{directory}};
+            static_cast<void>(cached_exact<cart_gate_clk_lyt>(mux, ps, disk_cache));
+        }
+
+        CHECK(!std::filesystem::is_empty(directory));
+
+        // a new cache restores the layout from disk
+        exact_physical_design_cache disk_cache{exact_physical_design_cache_params{directory}};
+
+        const auto hit_layout = cached_exact<cart_gate_clk_lyt>(mux, ps, disk_cache);
+
+        REQUIRE(hit_layout.has_value());
+
+        check_eq(mux, *hit_layout);
+
+        CHECK(disk_cache.hits() == 1);
+        CHECK(disk_cache.misses() == 0);
+
+        std::filesystem::remove_all(directory);
+    }
+    SECTION("different parameters")
+    {
+        auto crossings_ps      = ps;
+        crossings_ps.crossings = true;
+
+        const auto layout = cached_exact<cart_gate_clk_lyt>(mux, crossings_ps, cache);
+
+        REQUIRE(layout.has_value());
+
+        check_eq(mux, *layout);
+
+        CHECK(cache.misses() == 2);
+        CHECK(cache.size() == 2);
+    }
+    SECTION("open clocking")
+    {
+        auto open_ps = ps;
+        open_ps.scheme =
+            std::make_shared<clocking_scheme<coordinate<cart_gate_clk_lyt>>>(open_clocking<cart_gate_clk_lyt>());
+        open_ps.crossings = true;
+
+        const auto and_or = blueprints::and_or_network<mockturtle::mig_network>();
+
+        const auto open_layout = cached_exact<cart_gate_clk_lyt>(and_or, open_ps, cache);
+
+        REQUIRE(open_layout.has_value());
+
+        // the individually assigned clock numbers are restored
+        const auto hit_layout = cached_exact<cart_gate_clk_lyt>(and_or, open_ps, cache);
+
+        REQUIRE(hit_layout.has_value());
+
+        check_eq(and_or, *hit_layout);
+        check_identical_layouts(*open_layout, *hit_layout);
+
+        open_layout->foreach_ground_tile(
+            [&open_layout, &hit_layout](const auto& t)
+            { CHECK(hit_layout->get_clock_number(t) == open_layout->get_clock_number(t)); });
+    }
+}
+
+TEST_CASE("Unsatisfiable aspect ratios of exact physical design", "[exact]")
+{
+    const auto mux = blueprints::mux21_network<mockturtle::aig_network>();
+
+    exact_physical_design_params<cart_gate_clk_lyt> ps{};
+    ps.num_threads = 1;
+
+    exact_physical_design_stats stats{};
+    const auto                  layout = exact<cart_gate_clk_lyt>(mux, ps, &stats);
+
+    REQUIRE(layout.has_value());
+    REQUIRE(!stats.unsatisfiable_aspect_ratios.empty());
+
+    CHECK(stats.optimal);
+
+    SECTION("known unsatisfiable aspect ratios are skipped")
+    {
+        ps.unsatisfiable_aspect_ratios = stats.unsatisfiable_aspect_ratios;
+
+        exact_physical_design_stats skipping_stats{};
+        const auto                  skipping_layout = exact<cart_gate_clk_lyt>(mux, ps, &skipping_stats);
+
+        REQUIRE(skipping_layout.has_value());
+
+        check_eq(mux, *skipping_layout);
+
+        CHECK(skipping_stats.unsatisfiable_aspect_ratios.empty());
+        CHECK(skipping_stats.x_size == stats.x_size);
+        CHECK(skipping_stats.y_size == stats.y_size);
+        CHECK(skipping_stats.optimal);
+    }
+    SECTION("several threads")
+    {
+        ps.num_threads = 4;
+
+        exact_physical_design_stats parallel_stats{};
+        static_cast<void>(exact<cart_gate_clk_lyt>(mux, ps, &parallel_stats));
+
+        // the jobs are completed in arbitrary order but reported sorted
+        CHECK(std::is_sorted(parallel_stats.unsatisfiable_aspect_ratios.cbegin(),
+                             parallel_stats.unsatisfiable_aspect_ratios.cend()));
+
+        for (const auto& ar : parallel_stats.unsatisfiable_aspect_ratios)
+        {
+            CHECK(ar != std::make_pair(stats.x_size, stats.y_size));
+        }
+
+        CHECK(parallel_stats.x_size == stats.x_size);
+        CHECK(parallel_stats.y_size == stats.y_size);
+        CHECK(parallel_stats.optimal);
+    }
+}
+
+#else  // FICTION_Z3_SOLVER
+
+TEST_CASE("Exact physical design cache", "[exact]")
+{
+    CHECK(true);  // workaround for empty test case
+}
+
+#endif  // FICTION_Z3_SOLVER
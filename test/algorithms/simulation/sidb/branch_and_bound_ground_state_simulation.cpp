@@ -0,0 +1,193 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/branch_and_bound_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/physical_constants.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_surface.hpp>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Empty layout branch-and-bound simulation", "[branch-and-bound]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    exgs_stats<TestType>             stats{};
+    const sidb_simulation_parameters params{2, -0.32};
+
+    branch_and_bound_ground_state_simulation<TestType>(lyt, params, &stats);
+
+    CHECK(stats.valid_lyts.empty());
+}
+
+TEMPLATE_TEST_CASE("Single SiDB branch-and-bound simulation", "[branch-and-bound]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+
+    exgs_stats<TestType>             stats{};
+    const sidb_simulation_parameters params{2, -0.32};
+
+    branch_and_bound_ground_state_simulation<TestType>(lyt, params, &stats);
+
+    REQUIRE(stats.valid_lyts.size() == 1);
+    CHECK(stats.valid_lyts.front().get_charge_state_by_index(0) == sidb_charge_state::NEGATIVE);
+}
+
+TEMPLATE_TEST_CASE("Branch-and-bound simulation of a two-pair BDL wire with one perturber", "[branch-and-bound]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({11, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({13, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({17, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({19, 0, 0}, TestType::cell_type::NORMAL);
+
+    exgs_stats<TestType>             stats{};
+    const sidb_simulation_parameters params{2, -0.32};
+
+    branch_and_bound_ground_state_simulation<TestType>(lyt, params, &stats);
+
+    REQUIRE(stats.valid_lyts.size() == 1);
+
+    const auto& charge_lyt_first = stats.valid_lyts.front();
+
+    CHECK(charge_lyt_first.get_charge_state({0, 0, 0}) == sidb_charge_state::NEGATIVE);
+    CHECK(charge_lyt_first.get_charge_state({5, 0, 0}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt_first.get_charge_state({7, 0, 0}) == sidb_charge_state::NEGATIVE);
+    CHECK(charge_lyt_first.get_charge_state({11, 0, 0}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt_first.get_charge_state({13, 0, 0}) == sidb_charge_state::NEGATIVE);
+    CHECK(charge_lyt_first.get_charge_state({17, 0, 0}) == sidb_charge_state::NEUTRAL);
+    CHECK(charge_lyt_first.get_charge_state({19, 0, 0}) == sidb_charge_state::NEGATIVE);
+
+    CHECK_THAT(charge_lyt_first.get_system_energy(),
+               Catch::Matchers::WithinAbs(0.24602741408, fiction::physical_constants::POP_STABILITY_ERR));
+}
+
+TEMPLATE_TEST_CASE("Branch-and-bound and exhaustive simulation find the same ground state", "[branch-and-bound]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({4, 1, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({2, 0, 0}, TestType::cell_type::NORMAL);
+
+    const auto check_identical_ground_states = [&lyt](const sidb_simulation_parameters& params)
+    {
+        exgs_stats<TestType> exhaustive_stats{};
+        exgs_stats<TestType> branch_and_bound_stats{};
+
+        exhaustive_ground_state_simulation<TestType>(lyt, params, &exhaustive_stats);
+        branch_and_bound_ground_state_simulation<TestType>(lyt, params, &branch_and_bound_stats);
+
+        REQUIRE(!exhaustive_stats.valid_lyts.empty());
+        REQUIRE(!branch_and_bound_stats.valid_lyts.empty());
+
+        const auto ground_state_energy = minimum_energy(exhaustive_stats.valid_lyts);
+
+        CHECK_THAT(minimum_energy(branch_and_bound_stats.valid_lyts),
+                   Catch::Matchers::WithinAbs(ground_state_energy, fiction::physical_constants::POP_STABILITY_ERR));
+
+        std::vector<charge_distribution_surface<TestType>> exhaustive_ground_states{};
+
+        for (const auto& charge_lyt : exhaustive_stats.valid_lyts)
+        {
+            if (charge_lyt.get_system_energy() <= ground_state_energy + fiction::physical_constants::POP_STABILITY_ERR)
+            {
+                exhaustive_ground_states.emplace_back(charge_lyt);
+            }
+        }
+
+        REQUIRE(branch_and_bound_stats.valid_lyts.size() == exhaustive_ground_states.size());
+
+        for (auto i = 0u; i < exhaustive_ground_states.size(); ++i)
+        {
+            CHECK(branch_and_bound_stats.valid_lyts[i].get_charge_index() ==
+                  exhaustive_ground_states[i].get_charge_index());
+            CHECK(branch_and_bound_stats.valid_lyts[i].get_all_sidb_charges() ==
+                  exhaustive_ground_states[i].get_all_sidb_charges());
+        }
+    };
+
+    SECTION("two-state simulation")
+    {
+        check_identical_ground_states(sidb_simulation_parameters{2, -0.32});
+        check_identical_ground_states(sidb_simulation_parameters{2, -0.28});
+        check_identical_ground_states(sidb_simulation_parameters{2, -0.25});
+    }
+    SECTION("three-state simulation")
+    {
+        check_identical_ground_states(sidb_simulation_parameters{3, -0.32});
+        check_identical_ground_states(sidb_simulation_parameters{3, -0.28});
+        check_identical_ground_states(sidb_simulation_parameters{3, -0.25});
+    }
+}
+
+TEMPLATE_TEST_CASE("Branch-and-bound simulation of a BDL wire with a charged defect as perturber", "[branch-and-bound]",
+                   (sidb_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>>))
+{
+    TestType lyt{{20, 10}};
+
+    // the defect has the charge of a negative SiDB and replaces the perturber
+    lyt.assign_sidb_defect({0, 0, 0}, sidb_defect{sidb_defect_type::DB, -1.0});
+
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({11, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({13, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({17, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({19, 0, 0}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters params{2, -0.32};
+
+    exgs_stats<TestType> exhaustive_stats{};
+    exhaustive_ground_state_simulation<TestType>(lyt, params, &exhaustive_stats);
+
+    exgs_stats<TestType> stats{};
+    branch_and_bound_ground_state_simulation<TestType>(lyt, params, &stats);
+
+    for (const auto* st : {&exhaustive_stats, &stats})
+    {
+        REQUIRE(st->valid_lyts.size() == 1);
+
+        const auto& charge_lyt = st->valid_lyts.front();
+
+        CHECK(charge_lyt.get_charge_state({5, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_lyt.get_charge_state({7, 0, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(charge_lyt.get_charge_state({11, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_lyt.get_charge_state({13, 0, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(charge_lyt.get_charge_state({17, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_lyt.get_charge_state({19, 0, 0}) == sidb_charge_state::NEGATIVE);
+
+        // the system energy equals that of the wire with a perturber SiDB, which has no self-energy
+        CHECK_THAT(charge_lyt.get_system_energy(),
+                   Catch::Matchers::WithinAbs(0.24602741408, fiction::physical_constants::POP_STABILITY_ERR));
+    }
+}
@@ -0,0 +1,231 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/energy_distribution.hpp>
+#include <fiction/algorithms/simulation/sidb/energy_statistics.hpp>
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Energy statistics accumulators", "[energy-statistics]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 1, 1}, TestType::cell_type::NORMAL);
+
+    charge_distribution_surface charge_lyt{lyt, sidb_simulation_parameters{3, -0.32}};
+
+    SECTION("histogram")
+    {
+        energy_histogram first{};
+        energy_histogram second{};
+
+        CHECK(first.empty());
+
+        first.add(-0.1);
+        first.add(-0.2);
+        second.add(-0.1 + 1E-9);
+
+        first.merge(second);
+
+        CHECK(first.size() == 3);
+        CHECK(first.get_distribution().size() == 2);
+        CHECK(first.get_distribution().at(energy_histogram::round(-0.1)) == 2);
+    }
+    SECTION("running minimum")
+    {
+        running_minimum_energy minimum{};
+
+        CHECK(minimum.get_value() == std::numeric_limits<double>::max());
+
+        minimum.add(0.3);
+        minimum.add(-0.1);
+
+        running_minimum_energy other{};
+        other.add(-0.2);
+
+        minimum.merge(other);
+
+        CHECK(minimum.get_value() == -0.2);
+    }
+    SECTION("lowest energy states")
+    {
+        lowest_energy_states<TestType> states{2};
+
+        charge_lyt.set_all_charge_states(sidb_charge_state::NEUTRAL);
+        charge_lyt.update_after_charge_change();
+        states.add(charge_lyt);
+
+        charge_lyt.assign_charge_state({0, 0, 0}, sidb_charge_state::NEGATIVE);
+        charge_lyt.assign_charge_state({7, 1, 1}, sidb_charge_state::POSITIVE);
+        charge_lyt.update_after_charge_change();
+        const auto dipole_energy = charge_lyt.get_system_energy();
+        states.add(charge_lyt);
+        // identical charge distributions are retained only once
+        states.add(charge_lyt);
+
+        CHECK(states.size() == 2);
+
+        // the distribution with only negative SiDBs has a higher energy than both retained ones
+        charge_lyt.set_all_charge_states(sidb_charge_state::NEGATIVE);
+        charge_lyt.update_after_charge_change();
+
+        lowest_energy_states<TestType> other{2};
+        other.add(charge_lyt);
+        states.merge(other);
+
+        const auto result = states.get_states();
+
+        REQUIRE(result.size() == 2);
+        CHECK(result[0].system_energy == dipole_energy);
+        CHECK(result[1].system_energy == 0.0);
+
+        const auto materialized = result.materialize(0);
+
+        CHECK(materialized.get_charge_state({0, 0, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(materialized.get_charge_state({4, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(materialized.get_charge_state({7, 1, 1}) == sidb_charge_state::POSITIVE);
+    }
+    SECTION("no states are retained for k = 0")
+    {
+        sidb_energy_statistics<TestType> statistics{0};
+
+        statistics.add(charge_lyt);
+
+        CHECK(!statistics.empty());
+        CHECK(statistics.lowest_states.size() == 0);
+        CHECK(statistics.lowest_states.get_states().empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("Energy statistics of the exhaustive ground state simulation", "[energy-statistics]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 50}};
+
+    // three distant pairs of SiDBs lead to several metastable charge distributions
+    for (const auto y : {0, 20, 40})
+    {
+        lyt.assign_cell_type({0, y, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({1, y, 0}, TestType::cell_type::NORMAL);
+    }
+
+    exgs_params params{sidb_simulation_parameters{3, -0.32}};
+    params.num_lowest_energy_states = 4;
+    params.number_threads           = 1;
+
+    exgs_stats<TestType> reference{};
+    exhaustive_ground_state_simulation(lyt, params, &reference);
+
+    const auto& statistics = reference.energy_statistics;
+
+    REQUIRE(reference.valid_lyts.size() > 4);
+
+    CHECK(statistics.histogram.get_distribution() == energy_distribution(reference.valid_lyts));
+    CHECK(statistics.histogram.size() == reference.valid_lyts.size());
+    CHECK(statistics.minimum.get_value() == minimum_energy(reference.valid_lyts));
+
+    std::vector<double> energies{};
+    std::transform(reference.valid_lyts.cbegin(), reference.valid_lyts.cend(), std::back_inserter(energies),
+                   [](const auto& charge_lyt) { return charge_lyt.get_system_energy(); });
+    std::sort(energies.begin(), energies.end());
+
+    const auto lowest_states = statistics.lowest_states.get_states();
+
+    REQUIRE(lowest_states.size() == 4);
+
+    for (std::size_t i = 0; i < lowest_states.size(); ++i)
+    {
+        CHECK_THAT(lowest_states[i].system_energy, Catch::Matchers::WithinAbs(energies[i], 1E-6));
+        CHECK(lowest_states.materialize(i).is_physically_valid());
+    }
+
+    SECTION("several threads")
+    {
+        params.number_threads = 4;
+
+        exgs_stats<TestType> stats{};
+        exhaustive_ground_state_simulation(lyt, params, &stats);
+
+        CHECK(stats.energy_statistics.histogram.get_distribution() == statistics.histogram.get_distribution());
+        CHECK_THAT(stats.energy_statistics.minimum.get_value(),
+                   Catch::Matchers::WithinAbs(statistics.minimum.get_value(), 1E-10));
+
+        const auto states = stats.energy_statistics.lowest_states.get_states();
+
+        REQUIRE(states.size() == lowest_states.size());
+
+        for (std::size_t i = 0; i < states.size(); ++i)
+        {
+            CHECK(states[i].charges == lowest_states[i].charges);
+        }
+    }
+    SECTION("without retaining the charge distributions")
+    {
+        params.retain_valid_lyts = false;
+
+        exgs_stats<TestType> stats{};
+        exhaustive_ground_state_simulation(lyt, params, &stats);
+
+        CHECK(stats.valid_lyts.empty());
+        CHECK(stats.compact_valid_lyts.empty());
+        CHECK(stats.energy_statistics.histogram.get_distribution() == statistics.histogram.get_distribution());
+        CHECK(stats.energy_statistics.lowest_states.size() == 4);
+    }
+    SECTION("report")
+    {
+        std::stringstream out{};
+        reference.report(out);
+
+        CHECK(out.str().find("the ground state energy is") != std::string::npos);
+        CHECK(out.str().find(fmt::format("{} phyiscally valid", reference.valid_lyts.size())) != std::string::npos);
+    }
+}
+
+TEMPLATE_TEST_CASE("Energy statistics of QuickSim", "[energy-statistics]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    quicksim_params params{sidb_simulation_parameters{2, -0.32}};
+    params.num_lowest_energy_states = 2;
+
+    quicksim_stats<TestType> stats{};
+    quicksim(lyt, params, &stats);
+
+    REQUIRE(!stats.valid_lyts.empty());
+
+    CHECK(stats.energy_statistics.histogram.get_distribution() == energy_distribution(stats.valid_lyts));
+    CHECK(stats.energy_statistics.minimum.get_value() == minimum_energy(stats.valid_lyts));
+
+    const auto lowest_states = stats.energy_statistics.lowest_states.get_states();
+
+    REQUIRE(!lowest_states.empty());
+    CHECK_THAT(lowest_states[0].system_energy,
+               Catch::Matchers::WithinAbs(minimum_energy(stats.valid_lyts), 1E-6));
+
+    std::stringstream out{};
+    stats.report(out);
+
+    CHECK(out.str().find("lowest energy state") != std::string::npos);
+}
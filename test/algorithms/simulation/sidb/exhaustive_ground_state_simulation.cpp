@@ -85,6 +85,47 @@ TEMPLATE_TEST_CASE("ExGS simulation of a two-pair BDL wire with one perturber",
                Catch::Matchers::WithinAbs(0.24602741408, fiction::physical_constants::POP_STABILITY_ERR));
 }
 
+TEMPLATE_TEST_CASE("ExGS simulation of two distant BDL wires with a cutoff radius", "[ExGS]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 50}};
+
+    for (const auto y : {0, 40})
+    {
+        for (const auto x : {0, 5, 7, 11, 13, 17, 19})
+        {
+            lyt.assign_cell_type({x, y, 0}, TestType::cell_type::NORMAL);
+        }
+    }
+
+    sidb_simulation_parameters params{2, -0.32};
+    params.cutoff_radius = 10 * 1E-9;
+
+    exgs_stats<TestType> exgs_stats{};
+    exhaustive_ground_state_simulation<TestType>(lyt, params, &exgs_stats);
+
+    REQUIRE(exgs_stats.valid_lyts.size() == 1);
+
+    const auto& charge_lyt_first = exgs_stats.valid_lyts.front();
+
+    CHECK(charge_lyt_first.has_sparse_potentials());
+
+    // both wires do not interact such that each of them adopts the ground state of a single wire
+    for (const auto y : {0, 40})
+    {
+        CHECK(charge_lyt_first.get_charge_state({0, y, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(charge_lyt_first.get_charge_state({5, y, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_lyt_first.get_charge_state({7, y, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(charge_lyt_first.get_charge_state({11, y, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_lyt_first.get_charge_state({13, y, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(charge_lyt_first.get_charge_state({17, y, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_lyt_first.get_charge_state({19, y, 0}) == sidb_charge_state::NEGATIVE);
+    }
+
+    CHECK_THAT(charge_lyt_first.get_system_energy(),
+               Catch::Matchers::WithinAbs(2 * 0.24602741408, fiction::physical_constants::POP_STABILITY_ERR));
+}
+
 TEMPLATE_TEST_CASE("ExGS simulation of a Y-shape SiDB arrangement", "[ExGS]",
                    (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
 {
@@ -158,3 +199,112 @@ TEMPLATE_TEST_CASE("ExGS simulation of a Y-shape SiDB OR gate with input 01", "[
     CHECK_THAT(charge_lyt_first.get_system_energy(),
                Catch::Matchers::WithinAbs(0.46621669, fiction::physical_constants::POP_STABILITY_ERR));
 }
+
+TEMPLATE_TEST_CASE("ExGS simulation with Gray code and lexicographic enumeration", "[ExGS]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+    const auto check_identical_results = [&lyt](const sidb_simulation_parameters& phys_params)
+    {
+        exgs_stats<TestType> gray_code_stats{};
+        exgs_stats<TestType> lexicographic_stats{};
+
+        exhaustive_ground_state_simulation<TestType>(lyt, exgs_params{phys_params, exgs_enumeration::GRAY_CODE},
+                                                     &gray_code_stats);
+        exhaustive_ground_state_simulation<TestType>(lyt, exgs_params{phys_params, exgs_enumeration::LEXICOGRAPHIC},
+                                                     &lexicographic_stats);
+
+        REQUIRE(!gray_code_stats.valid_lyts.empty());
+        REQUIRE(gray_code_stats.valid_lyts.size() == lexicographic_stats.valid_lyts.size());
+
+        for (auto i = 0u; i < gray_code_stats.valid_lyts.size(); ++i)
+        {
+            const auto& gray_code_lyt     = gray_code_stats.valid_lyts[i];
+            const auto& lexicographic_lyt = lexicographic_stats.valid_lyts[i];
+
+            CHECK(gray_code_lyt.get_charge_index() == lexicographic_lyt.get_charge_index());
+            CHECK(gray_code_lyt.get_all_sidb_charges() == lexicographic_lyt.get_all_sidb_charges());
+            CHECK_THAT(gray_code_lyt.get_system_energy() - lexicographic_lyt.get_system_energy(),
+                       Catch::Matchers::WithinAbs(0.0, fiction::physical_constants::POP_STABILITY_ERR));
+        }
+    };
+
+    SECTION("two-state simulation")
+    {
+        check_identical_results(sidb_simulation_parameters{2, -0.28});
+    }
+    SECTION("three-state simulation")
+    {
+        check_identical_results(sidb_simulation_parameters{3, -0.28});
+    }
+}
+
+TEMPLATE_TEST_CASE("Multithreaded ExGS simulation", "[ExGS]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({6, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({8, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({14, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 5, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 6, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({10, 8, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 1, 0}, TestType::cell_type::NORMAL);
+
+    const auto check_identical_results = [&lyt](const sidb_simulation_parameters& phys_params)
+    {
+        for (const auto enumeration : {exgs_enumeration::GRAY_CODE, exgs_enumeration::LEXICOGRAPHIC})
+        {
+            exgs_stats<TestType> single_threaded_stats{};
+            exhaustive_ground_state_simulation<TestType>(lyt, exgs_params{phys_params, enumeration, 1},
+                                                         &single_threaded_stats);
+
+            REQUIRE(!single_threaded_stats.valid_lyts.empty());
+
+            for (const auto num_threads : {0ul, 2ul, 3ul, 7ul, 100ul})
+            {
+                exgs_stats<TestType> multi_threaded_stats{};
+                exhaustive_ground_state_simulation<TestType>(lyt, exgs_params{phys_params, enumeration, num_threads},
+                                                             &multi_threaded_stats);
+
+                REQUIRE(multi_threaded_stats.valid_lyts.size() == single_threaded_stats.valid_lyts.size());
+
+                for (auto i = 0u; i < single_threaded_stats.valid_lyts.size(); ++i)
+                {
+                    const auto& single_threaded_lyt = single_threaded_stats.valid_lyts[i];
+                    const auto& multi_threaded_lyt  = multi_threaded_stats.valid_lyts[i];
+
+                    CHECK(multi_threaded_lyt.get_charge_index() == single_threaded_lyt.get_charge_index());
+                    CHECK(multi_threaded_lyt.get_all_sidb_charges() == single_threaded_lyt.get_all_sidb_charges());
+                    CHECK_THAT(multi_threaded_lyt.get_system_energy() - single_threaded_lyt.get_system_energy(),
+                               Catch::Matchers::WithinAbs(0.0, fiction::physical_constants::POP_STABILITY_ERR));
+                }
+            }
+        }
+    };
+
+    SECTION("two-state simulation")
+    {
+        check_identical_results(sidb_simulation_parameters{2, -0.28});
+    }
+    SECTION("three-state simulation")
+    {
+        check_identical_results(sidb_simulation_parameters{3, -0.28});
+    }
+}
@@ -0,0 +1,167 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/hierarchical_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/is_ground_state.hpp>
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+template <typename Lyt>
+void check_equivalence_to_exgs(const Lyt& lyt, const hierarchical_simulation_params& params)
+{
+    exgs_stats<Lyt> hierarchical_stats{};
+    hierarchical_ground_state_simulation(lyt, params, &hierarchical_stats);
+
+    exgs_stats<Lyt> exhaustive_stats{};
+    exhaustive_ground_state_simulation(lyt, params.phys_params, &exhaustive_stats);
+
+    REQUIRE(hierarchical_stats.valid_lyts.size() == exhaustive_stats.valid_lyts.size());
+
+    for (uint64_t i = 0; i < exhaustive_stats.valid_lyts.size(); ++i)
+    {
+        CHECK(hierarchical_stats.valid_lyts[i].get_all_sidb_charges() ==
+              exhaustive_stats.valid_lyts[i].get_all_sidb_charges());
+        CHECK_THAT(hierarchical_stats.valid_lyts[i].get_system_energy(),
+                   Catch::Matchers::WithinAbs(exhaustive_stats.valid_lyts[i].get_system_energy(), 1E-10));
+    }
+
+    CHECK(hierarchical_stats.energy_statistics.histogram.size() == exhaustive_stats.valid_lyts.size());
+}
+
+TEMPLATE_TEST_CASE("Hierarchical ground state simulation of separated SiDB pairs", "[hierarchical-simulation]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 50}};
+
+    for (const auto y : {0, 20, 40})
+    {
+        lyt.assign_cell_type({0, y, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({1, y, 0}, TestType::cell_type::NORMAL);
+    }
+
+    hierarchical_simulation_params params{sidb_simulation_parameters{3, -0.32}};
+
+    SECTION("one cluster per pair")
+    {
+        check_equivalence_to_exgs(lyt, params);
+    }
+    SECTION("one cluster per SiDB")
+    {
+        params.cluster_distance = 0.1 * 1E-9;
+
+        check_equivalence_to_exgs(lyt, params);
+    }
+    SECTION("a single cluster")
+    {
+        params.cluster_distance = 100 * 1E-9;
+
+        check_equivalence_to_exgs(lyt, params);
+    }
+    SECTION("a single cluster that exceeds the maximum cluster size")
+    {
+        params.cluster_distance = 100 * 1E-9;
+        params.max_cluster_size = 4;
+
+        check_equivalence_to_exgs(lyt, params);
+    }
+    SECTION("maximum cluster size of 0")
+    {
+        params.max_cluster_size = 0;
+
+        check_equivalence_to_exgs(lyt, params);
+    }
+}
+
+TEMPLATE_TEST_CASE("Hierarchical ground state simulation of a BDL wire", "[hierarchical-simulation]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{40, 10}};
+
+    // input perturber
+    lyt.assign_cell_type({2, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({16, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({18, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({22, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({24, 0, 0}, TestType::cell_type::NORMAL);
+
+    // output perturber
+    lyt.assign_cell_type({28, 0, 0}, TestType::cell_type::NORMAL);
+
+    for (const auto base : {uint8_t{2}, uint8_t{3}})
+    {
+        // each BDL pair and each perturber forms a cluster
+        const hierarchical_simulation_params params{sidb_simulation_parameters{base, -0.32}};
+
+        check_equivalence_to_exgs(lyt, params);
+
+        // the heuristic combination finds the ground state as well
+        quicksim_stats<TestType> heuristic_stats{};
+        hierarchical_heuristic_simulation(lyt, params, &heuristic_stats);
+
+        exgs_stats<TestType> exhaustive_stats{};
+        exhaustive_ground_state_simulation(lyt, params.phys_params, &exhaustive_stats);
+
+        REQUIRE(heuristic_stats.valid_lyts.size() == 1);
+        CHECK(heuristic_stats.valid_lyts.front().is_physically_valid());
+        CHECK(heuristic_stats.completed_iterations > 0);
+        CHECK(is_ground_state(heuristic_stats, exhaustive_stats));
+    }
+}
+
+TEMPLATE_TEST_CASE("Hierarchical ground state simulation of many BDL pairs", "[hierarchical-simulation]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{100, 100}};
+
+    // 40 SiDBs, i.e., 3^40 charge distributions, are out of reach for the exhaustive ground state simulation
+    for (const auto x : {0, 20, 40, 60})
+    {
+        for (const auto y : {0, 10, 20, 30, 40})
+        {
+            lyt.assign_cell_type({x, y, 0}, TestType::cell_type::NORMAL);
+            lyt.assign_cell_type({x + 2, y, 0}, TestType::cell_type::NORMAL);
+        }
+    }
+
+    const hierarchical_simulation_params params{sidb_simulation_parameters{3, -0.32}};
+
+    exgs_stats<TestType> exact_stats{};
+    hierarchical_ground_state_simulation(lyt, params, &exact_stats);
+
+    REQUIRE(!exact_stats.valid_lyts.empty());
+
+    for (const auto& valid_lyt : exact_stats.valid_lyts)
+    {
+        CHECK(valid_lyt.is_physically_valid());
+    }
+
+    quicksim_stats<TestType> heuristic_stats{};
+    hierarchical_heuristic_simulation(lyt, params, &heuristic_stats);
+
+    CHECK(is_ground_state(heuristic_stats, exact_stats));
+}
+
+TEMPLATE_TEST_CASE("Hierarchical ground state simulation of an empty layout", "[hierarchical-simulation]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    const TestType lyt{{10, 10}};
+
+    exgs_stats<TestType> stats{};
+    hierarchical_ground_state_simulation(lyt, hierarchical_simulation_params{}, &stats);
+
+    CHECK(stats.valid_lyts.empty());
+    CHECK(stats.energy_statistics.empty());
+}
@@ -0,0 +1,215 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/input_pattern_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_surface.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace fiction;
+
+// a wire of three BDL pairs whose output is fixed by a perturber if no input perturber is close enough
+template <typename Lyt>
+Lyt create_bdl_wire()
+{
+    Lyt lyt{{40, 10}};
+
+    lyt.assign_cell_type({10, 0, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 0, 0}, Lyt::cell_type::NORMAL);
+
+    lyt.assign_cell_type({16, 0, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({18, 0, 0}, Lyt::cell_type::NORMAL);
+
+    lyt.assign_cell_type({22, 0, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({24, 0, 0}, Lyt::cell_type::NORMAL);
+
+    // output perturber
+    lyt.assign_cell_type({28, 0, 0}, Lyt::cell_type::NORMAL);
+
+    return lyt;
+}
+
+TEMPLATE_TEST_CASE("Input pattern simulation of a BDL wire", "[input-pattern-simulation]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    const auto lyt = create_bdl_wire<TestType>();
+
+    const std::vector<sidb_input_overlay<TestType>> inputs{{{{2, 0, 0}}, {{8, 0, 0}}}};
+    const std::vector<sidb_bdl_pair<TestType>>      outputs{{{22, 0, 0}, {24, 0, 0}}};
+
+    input_pattern_simulation_params params{sidb_simulation_parameters{2, -0.32}};
+
+    input_pattern_simulation_stats<TestType> stats{};
+
+    SECTION("identity")
+    {
+        CHECK(simulate_input_patterns(lyt, inputs, outputs, std::vector{create_id_tt()}, params, &stats));
+
+        REQUIRE(stats.results.size() == 2);
+
+        for (uint64_t pattern = 0; pattern < 2; ++pattern)
+        {
+            const auto& res = stats.results[pattern];
+
+            CHECK(res.pattern == pattern);
+            CHECK(res.matched);
+            REQUIRE(res.ground_state.has_value());
+            CHECK(res.ground_state->num_cells() == 8);
+        }
+
+        CHECK(stats.results[0].ground_state->get_charge_state({22, 0, 0}) == sidb_charge_state::NEGATIVE);
+        CHECK(stats.results[0].ground_state->get_charge_state({24, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(stats.results[1].ground_state->get_charge_state({22, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(stats.results[1].ground_state->get_charge_state({24, 0, 0}) == sidb_charge_state::NEGATIVE);
+    }
+    SECTION("negation")
+    {
+        CHECK(!simulate_input_patterns(lyt, inputs, outputs, std::vector{create_not_tt()}, params, &stats));
+
+        REQUIRE(stats.results.size() == 2);
+        CHECK(!stats.results[0].matched);
+        CHECK(!stats.results[1].matched);
+    }
+    SECTION("ground states match separate simulations")
+    {
+        params.number_threads = 1;
+
+        simulate_input_patterns(lyt, inputs, outputs, std::vector{create_id_tt()}, params, &stats);
+
+        for (uint64_t pattern = 0; pattern < 2; ++pattern)
+        {
+            auto pattern_lyt = create_bdl_wire<TestType>();
+            pattern_lyt.assign_cell_type(pattern == 0 ? inputs[0].sidbs_if_false[0] : inputs[0].sidbs_if_true[0],
+                                         TestType::cell_type::NORMAL);
+
+            exgs_stats<TestType> exgs_stats{};
+            exhaustive_ground_state_simulation(pattern_lyt, params.phys_params, &exgs_stats);
+
+            CHECK_THAT(stats.results[pattern].ground_state->get_system_energy(),
+                       Catch::Matchers::WithinAbs(minimum_energy(exgs_stats.valid_lyts), 1E-10));
+        }
+    }
+    SECTION("QuickSim")
+    {
+        params.engine = input_pattern_simulation_engine::QUICKSIM;
+
+        CHECK(simulate_input_patterns(lyt, inputs, outputs, std::vector{create_id_tt()}, params, &stats));
+        CHECK(stats.results.size() == 2);
+    }
+}
+
+TEMPLATE_TEST_CASE("Input pattern simulation with two inputs", "[input-pattern-simulation]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    const auto lyt = create_bdl_wire<TestType>();
+
+    // the second input is far away from the wire such that the output only depends on the first input
+    const std::vector<sidb_input_overlay<TestType>> inputs{{{{2, 0, 0}}, {{8, 0, 0}}},
+                                                           {{{10, 9, 0}}, {{24, 9, 0}}}};
+    const std::vector<sidb_bdl_pair<TestType>>      outputs{{{22, 0, 0}, {24, 0, 0}}};
+
+    // projection onto the first variable
+    kitty::dynamic_truth_table tt{2};
+    constexpr const uint64_t   lit = 0xa;
+    kitty::create_from_words(tt, &lit, &lit + 1);
+
+    input_pattern_simulation_stats<TestType> stats{};
+
+    for (const auto num_threads : {0ul, 1ul, 3ul, 16ul})
+    {
+        input_pattern_simulation_params params{sidb_simulation_parameters{2, -0.32}};
+        params.number_threads = num_threads;
+
+        CHECK(simulate_input_patterns(lyt, inputs, outputs, std::vector{tt}, params, &stats));
+
+        REQUIRE(stats.results.size() == 4);
+
+        for (uint64_t pattern = 0; pattern < 4; ++pattern)
+        {
+            CHECK(stats.results[pattern].pattern == pattern);
+            CHECK(stats.results[pattern].matched);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Input pattern simulation with SiDB defects", "[input-pattern-simulation]",
+                   (sidb_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>>))
+{
+    auto lyt = create_bdl_wire<TestType>();
+
+    // a negatively charged defect next to the output pair
+    lyt.assign_sidb_defect({26, 2, 0}, sidb_defect{sidb_defect_type::DB, -1.0});
+
+    const std::vector<sidb_input_overlay<TestType>> inputs{{{{2, 0, 0}}, {{8, 0, 0}}}};
+    const std::vector<sidb_bdl_pair<TestType>>      outputs{{{22, 0, 0}, {24, 0, 0}}};
+
+    input_pattern_simulation_params params{sidb_simulation_parameters{2, -0.32}};
+
+    input_pattern_simulation_stats<TestType> stats{};
+    simulate_input_patterns(lyt, inputs, outputs, std::vector{create_id_tt()}, params, &stats);
+
+    REQUIRE(stats.results.size() == 2);
+
+    for (uint64_t pattern = 0; pattern < 2; ++pattern)
+    {
+        REQUIRE(stats.results[pattern].ground_state.has_value());
+
+        // the defect is part of the simulated layouts
+        auto pattern_lyt = create_bdl_wire<TestType>();
+        pattern_lyt.assign_sidb_defect({26, 2, 0}, sidb_defect{sidb_defect_type::DB, -1.0});
+        pattern_lyt.assign_cell_type(pattern == 0 ? inputs[0].sidbs_if_false[0] : inputs[0].sidbs_if_true[0],
+                                     TestType::cell_type::NORMAL);
+
+        exgs_stats<TestType> exgs_stats{};
+        exhaustive_ground_state_simulation(pattern_lyt, params.phys_params, &exgs_stats);
+
+        CHECK_THAT(stats.results[pattern].ground_state->get_system_energy(),
+                   Catch::Matchers::WithinAbs(minimum_energy(exgs_stats.valid_lyts), 1E-10));
+    }
+}
+
+TEST_CASE("Input pattern simulation retains the properties of the SiDB surface", "[input-pattern-simulation]")
+{
+    using cell_lyt = cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>;
+
+    cell_lyt base_lyt{{40, 10}, "wire", 20, 10};
+
+    const auto wire = create_bdl_wire<cell_lyt>();
+    wire.foreach_cell([&base_lyt, &wire](const auto& c) { base_lyt.assign_cell_type(c, wire.get_cell_type(c)); });
+
+    const sidb_surface_params surface_params{{sidb_defect_type::SI_VACANCY}};
+
+    const sidb_surface<cell_lyt> lyt{base_lyt, surface_params};
+
+    const std::vector<sidb_input_overlay<sidb_surface<cell_lyt>>> inputs{{{{2, 0, 0}}, {{8, 0, 0}}}};
+    const std::vector<sidb_bdl_pair<sidb_surface<cell_lyt>>>      outputs{{{22, 0, 0}, {24, 0, 0}}};
+
+    input_pattern_simulation_params params{sidb_simulation_parameters{2, -0.32}};
+
+    input_pattern_simulation_stats<sidb_surface<cell_lyt>> stats{};
+    simulate_input_patterns(lyt, inputs, outputs, std::vector{create_id_tt()}, params, &stats);
+
+    REQUIRE(stats.results.size() == 2);
+
+    for (const auto& result : stats.results)
+    {
+        REQUIRE(result.ground_state.has_value());
+
+        CHECK(result.ground_state->get_layout_name() == "wire");
+        CHECK(result.ground_state->get_tile_size_x() == 20);
+        CHECK(result.ground_state->get_tile_size_y() == 10);
+        CHECK(result.ground_state->get_sidb_surface_parameters().ignore == surface_params.ignore);
+    }
+}
@@ -61,4 +61,29 @@ TEMPLATE_TEST_CASE(
 
         CHECK(is_ground_state(quicksimstats, exgs_stats));
     }
+
+    SECTION("statistics without accumulated energies")
+    {
+        TestType lyt{{20, 10}};
+
+        lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+
+        charge_distribution_surface      charge_layout{lyt};
+        exgs_stats<TestType>             exgs_stats{};
+        const sidb_simulation_parameters params{2, -0.32};
+        exhaustive_ground_state_simulation<TestType>(charge_layout, params, &exgs_stats);
+        quicksim_stats<TestType> quicksimstats{};
+        const quicksim_params    quicksim_params{params};
+        quicksim<TestType>(charge_layout, quicksim_params, &quicksimstats);
+
+        // statistics that only hold the charge distributions, e.g., filled by hand, are evaluated as well
+        exgs_stats.energy_statistics    = {};
+        quicksimstats.energy_statistics = {};
+
+        REQUIRE(!exgs_stats.valid_lyts.empty());
+
+        CHECK(is_ground_state(quicksimstats, exgs_stats));
+    }
 }
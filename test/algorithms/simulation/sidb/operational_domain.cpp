@@ -0,0 +1,117 @@
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/input_pattern_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Operational domain of a BDL wire", "[operational-domain]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{40, 10}};
+
+    lyt.assign_cell_type({10, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({16, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({18, 0, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({22, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({24, 0, 0}, TestType::cell_type::NORMAL);
+
+    // output perturber
+    lyt.assign_cell_type({28, 0, 0}, TestType::cell_type::NORMAL);
+
+    const std::vector<sidb_input_overlay<TestType>> inputs{{{{2, 0, 0}}, {{8, 0, 0}}}};
+    const std::vector<sidb_bdl_pair<TestType>>      outputs{{{22, 0, 0}, {24, 0, 0}}};
+    const std::vector                               spec{create_id_tt()};
+
+    operational_domain_params params{};
+    params.simulation_parameters = input_pattern_simulation_params{sidb_simulation_parameters{2, -0.32}};
+    params.mu_values             = {-0.4, -0.32, -0.1};
+    params.epsilon_r_values      = {5.6, 8.0};
+    params.lambda_tf_values      = {5.0 * 1E-9};
+    params.number_threads        = 1;
+
+    operational_domain_stats stats{};
+    const auto               domain = determine_operational_domain(lyt, inputs, outputs, spec, params, &stats);
+
+    REQUIRE(domain.points.size() == 6);
+
+    SECTION("grid order")
+    {
+        CHECK(domain.points[0].mu == -0.4);
+        CHECK(domain.points[1].mu == -0.32);
+        CHECK(domain.points[2].mu == -0.1);
+        CHECK(domain.points[2].epsilon_r == 5.6);
+        CHECK(domain.points[3].mu == -0.4);
+        CHECK(domain.points[3].epsilon_r == 8.0);
+
+        for (const auto& p : domain.points)
+        {
+            CHECK(p.lambda_tf == 5.0 * 1E-9);
+        }
+    }
+    SECTION("grid points match separate simulations")
+    {
+        for (const auto& p : domain.points)
+        {
+            auto simulation_params        = params.simulation_parameters;
+            simulation_params.phys_params = sidb_simulation_parameters{2, p.mu, p.epsilon_r, p.lambda_tf};
+
+            CHECK(p.operational == simulate_input_patterns(lyt, inputs, outputs, spec, simulation_params));
+        }
+
+        // the wire operates at the default parameters
+        CHECK(domain.points[1].operational);
+        CHECK(stats.num_operational_points + stats.num_non_operational_points == 6);
+    }
+    SECTION("potentials are only re-derived if the screening changes")
+    {
+        // the grid points with the default epsilon_r reuse the potentials of the shared model
+        CHECK(stats.num_potential_derivations == 1);
+    }
+    SECTION("several threads")
+    {
+        params.number_threads = 4;
+
+        const auto parallel_domain = determine_operational_domain(lyt, inputs, outputs, spec, params);
+
+        REQUIRE(parallel_domain.points.size() == domain.points.size());
+
+        for (std::size_t i = 0; i < domain.points.size(); ++i)
+        {
+            CHECK(parallel_domain.points[i].mu == domain.points[i].mu);
+            CHECK(parallel_domain.points[i].epsilon_r == domain.points[i].epsilon_r);
+            CHECK(parallel_domain.points[i].operational == domain.points[i].operational);
+        }
+    }
+    SECTION("default values")
+    {
+        params.mu_values        = {};
+        params.epsilon_r_values = {};
+
+        const auto default_domain = determine_operational_domain(lyt, inputs, outputs, spec, params);
+
+        REQUIRE(default_domain.points.size() == 1);
+        CHECK(default_domain.points[0].mu == -0.32);
+        CHECK(default_domain.points[0].epsilon_r == 5.6);
+        CHECK(default_domain.points[0].operational);
+    }
+    SECTION("report")
+    {
+        std::stringstream out{};
+        stats.report(out);
+
+        CHECK(out.str().find("of 6 grid points are operational") != std::string::npos);
+    }
+}
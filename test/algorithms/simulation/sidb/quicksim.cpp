@@ -12,6 +12,10 @@
 #include <fiction/technology/cell_technologies.hpp>
 #include <fiction/technology/physical_constants.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 using namespace fiction;
 
 TEMPLATE_TEST_CASE("Empty layout QuickSim simulation", "[quicksim]",
@@ -496,3 +500,207 @@ TEMPLATE_TEST_CASE("QuickSim simulation of an SiDB BDL pair with varying thread
         check_charge_configuration(quicksimstats);
     }
 }
+
+TEMPLATE_TEST_CASE("QuickSim simulation with compactly stored results", "[quicksim]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    quicksim_stats<TestType> quicksimstats{};
+    quicksim_params          quicksim_params{sidb_simulation_parameters{2, -0.30}};
+    quicksim_params.compact_results = true;
+
+    quicksim<TestType>(lyt, quicksim_params, &quicksimstats);
+
+    CHECK(quicksimstats.valid_lyts.empty());
+    REQUIRE(!quicksimstats.compact_valid_lyts.empty());
+
+    for (auto i = 0u; i < quicksimstats.compact_valid_lyts.size(); ++i)
+    {
+        const auto materialized_lyt = quicksimstats.compact_valid_lyts.materialize(i);
+
+        CHECK(quicksimstats.compact_valid_lyts[i].validity);
+        CHECK(materialized_lyt.is_physically_valid());
+        CHECK(!materialized_lyt.charge_exists(sidb_charge_state::POSITIVE));
+        CHECK_THAT(materialized_lyt.get_system_energy() - quicksimstats.compact_valid_lyts[i].system_energy,
+                   Catch::Matchers::WithinAbs(0.0, fiction::physical_constants::POP_STABILITY_ERR));
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickSim simulation is reproducible for a given seed and thread count", "[quicksim]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 10, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 10, 0}, TestType::cell_type::NORMAL);
+
+    quicksim_params quicksim_params{sidb_simulation_parameters{2, -0.30}};
+    quicksim_params.interation_steps = 20;
+    quicksim_params.seed             = 42;
+
+    for (const auto num_threads : {1ul, 3ul})
+    {
+        quicksim_params.number_threads = num_threads;
+
+        quicksim_stats<TestType> first_run{};
+        quicksim_stats<TestType> second_run{};
+
+        quicksim<TestType>(lyt, quicksim_params, &first_run);
+        quicksim<TestType>(lyt, quicksim_params, &second_run);
+
+        REQUIRE(!first_run.valid_lyts.empty());
+        REQUIRE(first_run.valid_lyts.size() == second_run.valid_lyts.size());
+
+        for (auto i = 0u; i < first_run.valid_lyts.size(); ++i)
+        {
+            CHECK(first_run.valid_lyts[i].get_all_sidb_charges() == second_run.valid_lyts[i].get_all_sidb_charges());
+            CHECK(first_run.valid_lyts[i].get_system_energy() == second_run.valid_lyts[i].get_system_energy());
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickSim simulation in single precision", "[quicksim]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 10, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 10, 0}, TestType::cell_type::NORMAL);
+
+    quicksim_params quicksim_params{sidb_simulation_parameters{2, -0.30}};
+    quicksim_params.interation_steps = 20;
+    quicksim_params.number_threads   = 2;
+    quicksim_params.seed             = 42;
+
+    quicksim_stats<TestType> double_precision_stats{};
+    quicksim<TestType>(lyt, quicksim_params, &double_precision_stats);
+
+    quicksim_params.single_precision = true;
+
+    quicksim_stats<TestType> single_precision_stats{};
+    quicksim<TestType>(lyt, quicksim_params, &single_precision_stats);
+
+    // no charge distribution is close enough to the validity bounds to be decided differently in single precision
+    REQUIRE(!double_precision_stats.valid_lyts.empty());
+    REQUIRE(single_precision_stats.valid_lyts.size() == double_precision_stats.valid_lyts.size());
+
+    for (auto i = 0u; i < single_precision_stats.valid_lyts.size(); ++i)
+    {
+        const auto& valid_lyt = single_precision_stats.valid_lyts[i];
+
+        // the results are verified and stored in double precision
+        CHECK(valid_lyt.is_physically_valid());
+        CHECK(valid_lyt.get_all_sidb_charges() == double_precision_stats.valid_lyts[i].get_all_sidb_charges());
+        CHECK_THAT(valid_lyt.get_system_energy(),
+                   Catch::Matchers::WithinAbs(double_precision_stats.valid_lyts[i].get_system_energy(), 1E-12));
+    }
+
+    CHECK(single_precision_stats.energy_statistics.minimum.get_value() ==
+          double_precision_stats.energy_statistics.minimum.get_value());
+
+    SECTION("compactly stored results")
+    {
+        quicksim_params.compact_results = true;
+
+        quicksim_stats<TestType> compact_stats{};
+        quicksim<TestType>(lyt, quicksim_params, &compact_stats);
+
+        CHECK(compact_stats.valid_lyts.empty());
+        CHECK(compact_stats.compact_valid_lyts.size() == single_precision_stats.valid_lyts.size());
+    }
+}
+
+TEMPLATE_TEST_CASE("QuickSim simulation with early termination", "[quicksim]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 10, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 10, 0}, TestType::cell_type::NORMAL);
+
+    quicksim_stats<TestType> quicksimstats{};
+    quicksim_params          quicksim_params{sidb_simulation_parameters{2, -0.30}};
+    quicksim_params.seed = 42;
+
+    SECTION("no termination criterion")
+    {
+        quicksim<TestType>(lyt, quicksim_params, &quicksimstats);
+
+        CHECK(!quicksimstats.terminated_early);
+        CHECK(quicksimstats.completed_iterations ==
+              std::max(quicksim_params.interation_steps / std::max(quicksim_params.number_threads, uint64_t{1}),
+                       uint64_t{1}) *
+                  std::max(quicksim_params.number_threads, uint64_t{1}));
+    }
+    SECTION("energy plateau")
+    {
+        quicksim_params.number_threads     = 1;
+        quicksim_params.plateau_iterations = 5;
+
+        quicksim<TestType>(lyt, quicksim_params, &quicksimstats);
+
+        CHECK(quicksimstats.terminated_early);
+        CHECK(quicksimstats.completed_iterations < quicksim_params.interation_steps);
+        CHECK(!quicksimstats.valid_lyts.empty());
+        check_for_absence_of_positive_charges(quicksimstats);
+    }
+    SECTION("exhausted time budget")
+    {
+        quicksim_params.timeout = 0;
+
+        quicksim<TestType>(lyt, quicksim_params, &quicksimstats);
+
+        CHECK(quicksimstats.terminated_early);
+        CHECK(quicksimstats.completed_iterations == 0);
+    }
+    SECTION("new minimum callback")
+    {
+        std::vector<double> reported_energies{};
+
+        quicksim_params.new_minimum_callback =
+            [&reported_energies](const std::vector<sidb_charge_state>& charges, const double energy)
+        {
+            CHECK(charges.size() == 7);
+            reported_energies.push_back(energy);
+        };
+
+        quicksim<TestType>(lyt, quicksim_params, &quicksimstats);
+
+        REQUIRE(!reported_energies.empty());
+
+        // the reported energies are strictly decreasing and the last one is the minimum energy found
+        CHECK(std::is_sorted(reported_energies.crbegin(), reported_energies.crend()));
+        CHECK(std::adjacent_find(reported_energies.cbegin(), reported_energies.cend()) == reported_energies.cend());
+        CHECK_THAT(reported_energies.back() - minimum_energy(quicksimstats.valid_lyts),
+                   Catch::Matchers::WithinAbs(0.0, fiction::physical_constants::POP_STABILITY_ERR));
+    }
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/is_ground_state.hpp>
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulated_annealing.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+using namespace fiction;
+
+TEMPLATE_TEST_CASE("Empty layout simulated annealing simulation", "[sidb-simulated-annealing]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    quicksim_stats<TestType> stats{};
+
+    sidb_simulated_annealing<TestType>(lyt, sidb_simulated_annealing_params{sidb_simulation_parameters{2, -0.30}},
+                                       &stats);
+
+    CHECK(stats.valid_lyts.empty());
+    CHECK(stats.compact_valid_lyts.empty());
+}
+
+TEMPLATE_TEST_CASE("Single SiDB simulated annealing simulation", "[sidb-simulated-annealing]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+
+    quicksim_stats<TestType> stats{};
+
+    sidb_simulated_annealing<TestType>(lyt, sidb_simulated_annealing_params{sidb_simulation_parameters{2, -0.30}},
+                                       &stats);
+
+    REQUIRE(!stats.valid_lyts.empty());
+
+    for (const auto& charge_lyt : stats.valid_lyts)
+    {
+        CHECK(charge_lyt.get_charge_state({1, 3, 0}) == sidb_charge_state::NEGATIVE);
+    }
+}
+
+TEMPLATE_TEST_CASE("Simulated annealing simulation of several SiDBs", "[sidb-simulated-annealing]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({4, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 3, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+    lyt.assign_cell_type({6, 10, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 10, 0}, TestType::cell_type::NORMAL);
+
+    sidb_simulated_annealing_params params{sidb_simulation_parameters{2, -0.32}};
+
+    exgs_stats<TestType> exgs_stats{};
+    exhaustive_ground_state_simulation<TestType>(lyt, params.phys_params, &exgs_stats);
+
+    quicksim_stats<TestType> stats{};
+
+    SECTION("Default settings")
+    {
+        sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+        REQUIRE(!stats.valid_lyts.empty());
+        CHECK(stats.completed_iterations == params.instances);
+        CHECK(stats.time_total.count() > 0);
+
+        for (const auto& charge_lyt : stats.valid_lyts)
+        {
+            CHECK(charge_lyt.is_physically_valid());
+            CHECK(!charge_lyt.charge_exists(sidb_charge_state::POSITIVE));
+        }
+
+        CHECK(is_ground_state(stats, exgs_stats));
+    }
+    SECTION("0 threads")
+    {
+        params.number_threads = 0;
+
+        sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+        CHECK(is_ground_state(stats, exgs_stats));
+    }
+    SECTION("more threads than instances")
+    {
+        params.number_threads = 100;
+        params.instances      = 4;
+
+        sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+        CHECK(stats.completed_iterations == 4);
+        CHECK(is_ground_state(stats, exgs_stats));
+    }
+    SECTION("no hops")
+    {
+        params.hop_probability = 0.0;
+
+        sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+        CHECK(is_ground_state(stats, exgs_stats));
+    }
+    SECTION("compact results")
+    {
+        params.compact_results = true;
+
+        sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+        CHECK(stats.valid_lyts.empty());
+        REQUIRE(!stats.compact_valid_lyts.empty());
+        CHECK_THAT(minimum_energy(stats.compact_valid_lyts),
+                   Catch::Matchers::WithinAbs(minimum_energy(exgs_stats.valid_lyts), 1E-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("Seeded simulated annealing simulation", "[sidb-simulated-annealing]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{60, 10}};
+
+    // a densely packed row of SiDBs for which not all annealing instances end in a physically valid charge distribution
+    for (uint64_t i = 0; i < 20; ++i)
+    {
+        lyt.assign_cell_type({2 * i, 0, 0}, TestType::cell_type::NORMAL);
+    }
+
+    sidb_simulated_annealing_params params{sidb_simulation_parameters{2, -0.32}};
+    params.seed = 42;
+
+    const auto charge_distributions = [&lyt, &params]
+    {
+        quicksim_stats<TestType> stats{};
+        sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+        // the order of the results depends on the scheduling of the instances
+        std::vector<std::vector<sidb_charge_state>> distributions{};
+        std::transform(stats.valid_lyts.cbegin(), stats.valid_lyts.cend(), std::back_inserter(distributions),
+                       [](const auto& charge_lyt) { return charge_lyt.get_all_sidb_charges(); });
+        std::sort(distributions.begin(), distributions.end());
+
+        return distributions;
+    };
+
+    params.number_threads = 1;
+
+    const auto single_threaded = charge_distributions();
+
+    REQUIRE(!single_threaded.empty());
+    CHECK(single_threaded.size() < params.instances);
+
+    SECTION("repeated run")
+    {
+        CHECK(charge_distributions() == single_threaded);
+    }
+    SECTION("several threads")
+    {
+        // the instances draw from the same random number streams regardless of the thread that runs them
+        params.number_threads = 4;
+
+        CHECK(charge_distributions() == single_threaded);
+    }
+}
+
+TEMPLATE_TEST_CASE("Simulated annealing simulation with three charge states", "[sidb-simulated-annealing]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 1, 0}, TestType::cell_type::NORMAL);
+
+    const sidb_simulated_annealing_params params{sidb_simulation_parameters{3, -0.32}};
+
+    exgs_stats<TestType> exgs_stats{};
+    exhaustive_ground_state_simulation<TestType>(lyt, params.phys_params, &exgs_stats);
+
+    quicksim_stats<TestType> stats{};
+    sidb_simulated_annealing<TestType>(lyt, params, &stats);
+
+    REQUIRE(!stats.valid_lyts.empty());
+
+    for (const auto& charge_lyt : stats.valid_lyts)
+    {
+        CHECK(charge_lyt.is_physically_valid());
+    }
+
+    CHECK(is_ground_state(stats, exgs_stats));
+}
@@ -0,0 +1,302 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/algorithms/simulation/sidb/minimum_energy.hpp>
+#include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_cache.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/technology/sidb_surface.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+using namespace fiction;
+
+template <typename Lyt>
+Lyt create_bdl_wire(const int32_t x, const int32_t y)
+{
+    Lyt lyt{{40, 20}};
+
+    lyt.assign_cell_type({x + 1, y + 3, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({x + 3, y + 3, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({x + 4, y + 3, 0}, Lyt::cell_type::NORMAL);
+
+    lyt.assign_cell_type({x + 6, y + 3, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({x + 7, y + 3, 1}, Lyt::cell_type::NORMAL);
+
+    lyt.assign_cell_type({x + 6, y + 10, 0}, Lyt::cell_type::NORMAL);
+    lyt.assign_cell_type({x + 7, y + 10, 0}, Lyt::cell_type::NORMAL);
+
+    return lyt;
+}
+
+template <typename Lyt>
+void check_translated_charge_distributions(const std::vector<charge_distribution_surface<Lyt>>& expected,
+                                           const std::vector<charge_distribution_surface<Lyt>>& actual,
+                                           const int32_t dx, const int32_t dy)
+{
+    REQUIRE(expected.size() == actual.size());
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        CHECK_THAT(actual[i].get_system_energy(),
+                   Catch::Matchers::WithinAbs(expected[i].get_system_energy(), 1E-10));
+        CHECK(actual[i].is_physically_valid() == expected[i].is_physically_valid());
+
+        expected[i].foreach_cell(
+            [&](const auto& c)
+            {
+                CHECK(actual[i].get_charge_state({c.x + dx, c.y + dy, c.z}) == expected[i].get_charge_state(c));
+            });
+    }
+}
+
+TEMPLATE_TEST_CASE("Canonical SiDB geometry", "[sidb-simulation-cache]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    SECTION("empty layout")
+    {
+        const TestType lyt{{20, 10}};
+
+        CHECK(canonicalize_sidb_geometry(lyt).sidbs.empty());
+    }
+    SECTION("translated layouts")
+    {
+        const auto lyt            = create_bdl_wire<TestType>(0, 0);
+        const auto lyt_translated = create_bdl_wire<TestType>(5, 7);
+
+        const auto geometry            = canonicalize_sidb_geometry(lyt);
+        const auto geometry_translated = canonicalize_sidb_geometry(lyt_translated);
+
+        CHECK(geometry.sidbs.size() == 7);
+        CHECK(geometry == geometry_translated);
+        CHECK(geometry.offset == siqad::coord_t{1, 3, 0});
+        CHECK(geometry_translated.offset == siqad::coord_t{6, 10, 0});
+        CHECK(std::is_sorted(geometry.sidbs.cbegin(), geometry.sidbs.cend()));
+    }
+    SECTION("different layouts")
+    {
+        auto lyt = create_bdl_wire<TestType>(0, 0);
+
+        const auto geometry = canonicalize_sidb_geometry(lyt);
+
+        lyt.assign_cell_type({7, 3, 1}, TestType::cell_type::EMPTY);
+        lyt.assign_cell_type({7, 3, 0}, TestType::cell_type::NORMAL);
+
+        CHECK(!(geometry == canonicalize_sidb_geometry(lyt)));
+    }
+}
+
+TEMPLATE_TEST_CASE("Cached exhaustive ground state simulation", "[sidb-simulation-cache]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    const auto lyt            = create_bdl_wire<TestType>(0, 0);
+    const auto lyt_translated = create_bdl_wire<TestType>(5, 7);
+
+    exgs_params params{sidb_simulation_parameters{3, -0.28}};
+
+    exgs_stats<TestType> reference{};
+    exhaustive_ground_state_simulation(lyt, params, &reference);
+
+    SECTION("in memory")
+    {
+        sidb_simulation_cache cache{};
+
+        exgs_stats<TestType> first{};
+        cached_exhaustive_ground_state_simulation(lyt, params, cache, &first);
+
+        CHECK(cache.size() == 1);
+        CHECK(cache.hits() == 0);
+        CHECK(cache.misses() == 1);
+        check_translated_charge_distributions(reference.valid_lyts, first.valid_lyts, 0, 0);
+
+        exgs_stats<TestType> second{};
+        cached_exhaustive_ground_state_simulation(lyt_translated, params, cache, &second);
+
+        CHECK(cache.size() == 1);
+        CHECK(cache.hits() == 1);
+        check_translated_charge_distributions(reference.valid_lyts, second.valid_lyts, 5, 7);
+
+        SECTION("compact results")
+        {
+            params.compact_results = true;
+
+            exgs_stats<TestType> compact{};
+            cached_exhaustive_ground_state_simulation(lyt_translated, params, cache, &compact);
+
+            CHECK(cache.hits() == 2);
+            CHECK(compact.valid_lyts.empty());
+            REQUIRE(compact.compact_valid_lyts.size() == reference.valid_lyts.size());
+            CHECK_THAT(minimum_energy(compact.compact_valid_lyts),
+                       Catch::Matchers::WithinAbs(minimum_energy(reference.valid_lyts), 1E-10));
+        }
+        SECTION("energy statistics without retained results")
+        {
+            params.retain_valid_lyts = false;
+
+            exgs_stats<TestType> restored{};
+            cached_exhaustive_ground_state_simulation(lyt_translated, params, cache, &restored);
+
+            CHECK(cache.hits() == 2);
+            CHECK(restored.valid_lyts.empty());
+            CHECK(restored.compact_valid_lyts.empty());
+            CHECK(restored.energy_statistics.histogram.size() == reference.valid_lyts.size());
+            CHECK_THAT(restored.energy_statistics.minimum.get_value(),
+                       Catch::Matchers::WithinAbs(minimum_energy(reference.valid_lyts), 1E-10));
+
+            exgs_stats<TestType> simulated{};
+            cached_exhaustive_ground_state_simulation(lyt_translated, exgs_params{sidb_simulation_parameters{2, -0.28},
+                                                                                  exgs_enumeration::GRAY_CODE, 1, false,
+                                                                                  false},
+                                                      cache, &simulated);
+
+            CHECK(cache.size() == 2);
+            CHECK(simulated.valid_lyts.empty());
+            CHECK(!simulated.energy_statistics.empty());
+        }
+        SECTION("different physical parameters")
+        {
+            params.phys_params = sidb_simulation_parameters{2, -0.28};
+
+            cached_exhaustive_ground_state_simulation<TestType>(lyt_translated, params, cache);
+
+            CHECK(cache.size() == 2);
+            CHECK(cache.misses() == 2);
+        }
+    }
+    SECTION("on disk")
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "fiction_sidb_simulation_cache_test";
+        std::filesystem::remove_all(directory);
+
+        {
+            sidb_simulation_cache cache{sidb_simulation_cache_params{directory}};
+            cached_exhaustive_ground_state_simulation<TestType>(lyt, params, cache);
+        }
+
+        CHECK(!std::filesystem::is_empty(directory));
+
+        // a new cache restores the result from disk
+        sidb_simulation_cache cache{sidb_simulation_cache_params{directory}};
+
+        exgs_stats<TestType> restored{};
+        cached_exhaustive_ground_state_simulation(lyt_translated, params, cache, &restored);
+
+        CHECK(cache.hits() == 1);
+        CHECK(cache.misses() == 0);
+        check_translated_charge_distributions(reference.valid_lyts, restored.valid_lyts, 5, 7);
+
+        std::filesystem::remove_all(directory);
+    }
+}
+
+TEMPLATE_TEST_CASE("Cached QuickSim simulation", "[sidb-simulation-cache]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    const auto lyt            = create_bdl_wire<TestType>(0, 0);
+    const auto lyt_translated = create_bdl_wire<TestType>(5, 7);
+
+    quicksim_params params{sidb_simulation_parameters{2, -0.32}};
+    params.seed = 42;
+
+    sidb_simulation_cache cache{};
+
+    quicksim_stats<TestType> first{};
+    cached_quicksim(lyt, params, cache, &first);
+
+    quicksim_stats<TestType> second{};
+    cached_quicksim(lyt_translated, params, cache, &second);
+
+    CHECK(cache.size() == 1);
+    CHECK(cache.hits() == 1);
+    check_translated_charge_distributions(first.valid_lyts, second.valid_lyts, 5, 7);
+
+    SECTION("different QuickSim parameters")
+    {
+        params.alpha = 0.5;
+
+        cached_quicksim<TestType>(lyt_translated, params, cache);
+
+        CHECK(cache.size() == 2);
+    }
+    SECTION("early terminated simulations are not cached")
+    {
+        params.timeout = 0;
+
+        cached_quicksim<TestType>(lyt, params, cache);
+        cached_quicksim<TestType>(lyt, params, cache);
+
+        CHECK(cache.size() == 1);
+    }
+    SECTION("unseeded simulations are not cached")
+    {
+        params.seed = std::nullopt;
+
+        cached_quicksim<TestType>(lyt, params, cache);
+        cached_quicksim<TestType>(lyt, params, cache);
+
+        CHECK(cache.size() == 1);
+        CHECK(cache.hits() == 1);
+    }
+    SECTION("new minimum callback on cache hits")
+    {
+        uint64_t num_calls       = 0;
+        double   reported_energy = 0.0;
+
+        params.new_minimum_callback = [&num_calls, &reported_energy](const auto& charges, const double energy)
+        {
+            CHECK(charges.size() == 7);
+
+            ++num_calls;
+            reported_energy = energy;
+        };
+
+        cached_quicksim<TestType>(lyt_translated, params, cache);
+
+        CHECK(cache.hits() == 2);
+        CHECK(num_calls == 1);
+        CHECK_THAT(reported_energy, Catch::Matchers::WithinAbs(minimum_energy(first.valid_lyts), 1e-9));
+    }
+}
+
+TEMPLATE_TEST_CASE("Layouts with charged defects are not cached", "[sidb-simulation-cache]",
+                   (sidb_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>>))
+{
+    auto lyt = create_bdl_wire<TestType>(0, 0);
+
+    sidb_simulation_cache cache{};
+
+    const exgs_params params{sidb_simulation_parameters{3, -0.28}};
+
+    SECTION("neutral defect")
+    {
+        lyt.assign_sidb_defect({20, 15, 0}, sidb_defect{sidb_defect_type::SILOXANE});
+
+        cached_exhaustive_ground_state_simulation(lyt, params, cache);
+
+        CHECK(cache.size() == 1);
+    }
+    SECTION("charged defect")
+    {
+        lyt.assign_sidb_defect({20, 15, 0}, sidb_defect{sidb_defect_type::DB, -1.0});
+
+        exgs_stats<TestType> reference{};
+        exhaustive_ground_state_simulation(lyt, params, &reference);
+
+        exgs_stats<TestType> stats{};
+        cached_exhaustive_ground_state_simulation(lyt, params, cache, &stats);
+        cached_quicksim(lyt, quicksim_params{params.phys_params}, cache);
+
+        CHECK(cache.size() == 0);
+        CHECK(stats.valid_lyts.size() == reference.valid_lyts.size());
+    }
+}
@@ -3,10 +3,12 @@
 //
 
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
 #include <fiction/algorithms/simulation/sidb/quicksim.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulated_annealing.hpp>
 #include <fiction/algorithms/simulation/sidb/time_to_solution.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/cell_level_layout.hpp>
@@ -59,5 +61,85 @@ TEMPLATE_TEST_CASE(
         CHECK(tts_stat.acc == 100);
         CHECK(tts_stat.time_to_solution > 0.0);
         CHECK(tts_stat.mean_single_runtime > 0.0);
+        CHECK(tts_stat.repetitions == 100);
+        CHECK(tts_stat.acc_lower > 90);
+        CHECK_THAT(tts_stat.acc_upper, Catch::Matchers::WithinAbs(100.0, 1E-10));
+
+        SECTION("branch-and-bound reference")
+        {
+            const time_to_solution_params tts_params{exhaustive_sidb_simulation_engine::BRANCH_AND_BOUND, 20};
+
+            time_to_solution_stats tts_stat_branch_and_bound{};
+            sim_acc_tts<TestType>(lyt, quicksim_params, tts_params, &tts_stat_branch_and_bound);
+
+            CHECK(tts_stat_branch_and_bound.acc == 100);
+            CHECK(tts_stat_branch_and_bound.time_to_solution > 0.0);
+            CHECK(tts_stat_branch_and_bound.mean_single_runtime > 0.0);
+        }
+        SECTION("simulated annealing")
+        {
+            const time_to_solution_params tts_params{exhaustive_sidb_simulation_engine::EXGS, 20};
+
+            time_to_solution_stats tts_stat_annealing{};
+            sim_acc_tts<TestType>(lyt, sidb_simulated_annealing_params{params}, tts_params, &tts_stat_annealing);
+
+            CHECK(tts_stat_annealing.acc == 100);
+            CHECK(tts_stat_annealing.time_to_solution > 0.0);
+            CHECK(tts_stat_annealing.mean_single_runtime > 0.0);
+        }
+        SECTION("concurrent repetitions with early stopping")
+        {
+            auto single_threaded_params           = quicksim_params;
+            single_threaded_params.number_threads = 1;
+
+            time_to_solution_params tts_params{exhaustive_sidb_simulation_engine::EXGS, 100};
+            tts_params.number_threads     = 4;
+            tts_params.max_interval_width = 0.2;
+
+            time_to_solution_stats tts_stat_early{};
+            sim_acc_tts<TestType>(lyt, single_threaded_params, tts_params, &tts_stat_early);
+
+            // a Wilson score interval at a confidence level of 95 % is at most 0.2 wide after 16 successes in a row
+            CHECK(tts_stat_early.acc == 100);
+            CHECK(tts_stat_early.repetitions >= 16);
+            CHECK(tts_stat_early.repetitions < 100);
+            CHECK_THAT(tts_stat_early.acc_upper, Catch::Matchers::WithinAbs(100.0, 1E-10));
+            CHECK(tts_stat_early.acc_upper - tts_stat_early.acc_lower <= 20);
+        }
+        SECTION("seeded repetitions")
+        {
+            auto seeded_params             = quicksim_params;
+            seeded_params.number_threads   = 1;
+            seeded_params.interation_steps = 2;
+            seeded_params.seed             = 7;
+
+            const time_to_solution_params tts_params{exhaustive_sidb_simulation_engine::EXGS, 50};
+
+            time_to_solution_stats tts_stat_seeded{};
+            sim_acc_tts<TestType>(lyt, seeded_params, tts_params, &tts_stat_seeded);
+
+            time_to_solution_stats tts_stat_reseeded{};
+            sim_acc_tts<TestType>(lyt, seeded_params, tts_params, &tts_stat_reseeded);
+
+            // each repetition draws from its own seed, but the accuracy is reproducible
+            CHECK(tts_stat_seeded.acc == tts_stat_reseeded.acc);
+            CHECK(tts_stat_seeded.repetitions == 50);
+        }
     }
 }
+
+TEST_CASE("Wilson score interval of the accuracy", "[sim_acc_tss]")
+{
+    CHECK_THAT(detail::normal_quantile(0.95), Catch::Matchers::WithinAbs(1.959964, 1E-6));
+    CHECK_THAT(detail::normal_quantile(0.997), Catch::Matchers::WithinAbs(2.967738, 1E-6));
+
+    const auto [lower, upper] = detail::wilson_interval(8, 10, detail::normal_quantile(0.95));
+
+    CHECK_THAT(lower, Catch::Matchers::WithinAbs(0.490162, 1E-6));
+    CHECK_THAT(upper, Catch::Matchers::WithinAbs(0.943318, 1E-6));
+
+    const auto [lower_none, upper_none] = detail::wilson_interval(0, 10, detail::normal_quantile(0.95));
+
+    CHECK_THAT(lower_none, Catch::Matchers::WithinAbs(0.0, 1E-10));
+    CHECK(upper_none < 0.5);
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/write_operational_domain.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Write an operational domain", "[write-operational-domain]")
+{
+    operational_domain domain{};
+    domain.points.push_back({-0.32, 5.6, 5.0 * 1E-9, true});
+    domain.points.push_back({-0.1, 5.6, 5.0 * 1E-9, false});
+
+    SECTION("CSV")
+    {
+        const auto filename = (std::filesystem::temp_directory_path() / "fiction_operational_domain_test.csv").string();
+
+        // an existing file is overwritten
+        write_operational_domain_csv(domain, filename);
+        write_operational_domain_csv(domain, filename);
+
+        std::ifstream            file{filename};
+        std::vector<std::string> lines{};
+
+        for (std::string line{}; std::getline(file, line);)
+        {
+            lines.push_back(line);
+        }
+
+        REQUIRE(lines.size() == 3);
+        CHECK(lines[0] == "mu, epsilon_r, lambda_tf, operational, ");
+        CHECK(lines[1] == "-0.32, 5.6, 5, 1, ");
+        CHECK(lines[2] == "-0.1, 5.6, 5, 0, ");
+
+        file.close();
+        std::filesystem::remove(filename);
+    }
+    SECTION("JSON")
+    {
+        std::stringstream os{};
+        write_operational_domain_json(domain, os);
+
+        const auto json = nlohmann::json::parse(os.str());
+
+        REQUIRE(json.size() == 2);
+        CHECK(json[0]["mu"] == -0.32);
+        CHECK(json[0]["epsilon_r"] == 5.6);
+        CHECK(json[0]["lambda_tf"] == 5.0);
+        CHECK(json[0]["operational"] == true);
+        CHECK(json[1]["operational"] == false);
+    }
+}
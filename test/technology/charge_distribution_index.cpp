@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/technology/charge_distribution_index.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+using namespace fiction;
+
+TEST_CASE("Charge distribution index arithmetic", "[charge-distribution-index]")
+{
+    SECTION("zero")
+    {
+        const charge_distribution_index zero{};
+
+        CHECK(zero == 0);
+        CHECK(zero == charge_distribution_index{0});
+        CHECK(zero.fits_uint64());
+        CHECK(zero.to_uint64() == 0);
+        CHECK(zero.num_words() == 0);
+        CHECK(zero.to_string() == "0");
+    }
+    SECTION("carry and borrow across words")
+    {
+        charge_distribution_index index{std::numeric_limits<uint64_t>::max()};
+
+        index += 1;
+
+        CHECK(!index.fits_uint64());
+        CHECK(index.num_words() == 2);
+        CHECK(index.to_string() == "18446744073709551616");
+        CHECK(index > std::numeric_limits<uint64_t>::max());
+
+        index -= 1;
+
+        CHECK(index.fits_uint64());
+        CHECK(index.to_uint64() == std::numeric_limits<uint64_t>::max());
+    }
+    SECTION("powers")
+    {
+        CHECK(charge_distribution_index::power(3, 0) == 1);
+        CHECK(charge_distribution_index::power(2, 10) == 1024);
+        CHECK(charge_distribution_index::power(3, 40).to_uint64() == 12157665459056928801ull);
+        CHECK(charge_distribution_index::power(3, 50).to_string() == "717897987691852588770249");
+        CHECK(charge_distribution_index::power(3, 41).to_string() == "36472996377170786403");
+    }
+    SECTION("division")
+    {
+        auto index = charge_distribution_index::power(3, 41);
+
+        CHECK(index.divide(3) == 0);
+        CHECK(index == charge_distribution_index::power(3, 40));
+
+        auto large = charge_distribution_index::from_string("1000000000000000000000000000000");
+
+        CHECK(large.divide(7) == 1);
+        CHECK(large.to_string() == "142857142857142857142857142857");
+    }
+    SECTION("decimal representation")
+    {
+        // chunks of nine digits with leading zeros
+        const auto index = charge_distribution_index::from_string("1000000000000000000001000000007");
+
+        CHECK(index.to_string() == "1000000000000000000001000000007");
+
+        std::stringstream ss{};
+        ss << index;
+
+        CHECK(ss.str() == index.to_string());
+    }
+    SECTION("ordering")
+    {
+        const auto small = charge_distribution_index::power(2, 63);
+        const auto large = charge_distribution_index::power(2, 64);
+        const auto two   = charge_distribution_index::power(2, 65);
+
+        CHECK(small < large);
+        CHECK(large < two);
+        CHECK(large <= large);
+        CHECK(two > small);
+        CHECK(two >= two);
+        CHECK(small != large);
+        CHECK(2 < small);
+    }
+}
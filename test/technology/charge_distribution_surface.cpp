@@ -414,6 +414,51 @@ TEMPLATE_TEST_CASE(
         CHECK(charge_layout_new.get_charge_index().first == 15);
     }
 
+    SECTION("charge index of a large layout")
+    {
+        TestType lyt_large{{100, 10}};
+
+        for (uint16_t x = 0; x < 100; ++x)
+        {
+            lyt_large.assign_cell_type({x, static_cast<uint16_t>(x % 3 == 0 ? 0 : 5), 0}, TestType::cell_type::NORMAL);
+        }
+
+        charge_distribution_surface charge_layout_large{lyt_large, sidb_simulation_parameters{3, -0.32}};
+
+        CHECK(charge_layout_large.get_charge_index().first == 0);
+        CHECK(charge_layout_large.get_max_charge_index().to_string() ==
+              "515377520732011331036461129765621272702107522000");
+
+        charge_layout_large.set_all_charge_states(sidb_charge_state::POSITIVE);
+        charge_layout_large.charge_distribution_to_index();
+
+        CHECK(charge_layout_large.get_charge_index().first == charge_layout_large.get_max_charge_index());
+
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            charge_layout_large.assign_charge_state_by_cell_index(
+                i, sign_to_charge_state(static_cast<int8_t>(static_cast<int8_t>(i % 3) - 1)));
+        }
+        charge_layout_large.charge_distribution_to_index();
+
+        const auto index = charge_layout_large.get_charge_index().first;
+
+        charge_layout_large.set_all_charge_states(sidb_charge_state::NEUTRAL);
+        charge_layout_large.assign_charge_index(index);
+
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            CHECK(charge_layout_large.get_charge_state_by_index(i) ==
+                  sign_to_charge_state(static_cast<int8_t>(static_cast<int8_t>(i % 3) - 1)));
+        }
+
+        charge_layout_large.increase_charge_index_by_one();
+
+        CHECK(charge_layout_large.get_charge_index().first > index);
+        CHECK(charge_layout_large.get_charge_state_by_index(99) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_layout_large.get_charge_state_by_index(98) == sidb_charge_state::POSITIVE);
+    }
+
     SECTION("using chargeless and normal potential function")
     {
         TestType                         lyt_new{{11, 11}};
@@ -451,4 +496,575 @@ TEMPLATE_TEST_CASE(
                        charge_layout_new.get_chargeless_potential_between_sidbs({0, 0, 1}, {1, 3, 0}),
                    Catch::Matchers::WithinAbs(0.0, 0.000001));
     }
+
+    SECTION("incremental update of the local potentials and the system energy")
+    {
+        lyt.assign_cell_type({0, 0, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({1, 3, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({4, 3, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({6, 5, 0}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 5, 1}, TestType::cell_type::NORMAL);
+
+        charge_distribution_surface charge_layout_incremental{lyt, sidb_simulation_parameters{}};
+        charge_distribution_surface charge_layout_full{lyt, sidb_simulation_parameters{}};
+
+        const auto check_equivalence = [&charge_layout_incremental, &charge_layout_full]()
+        {
+            charge_layout_full.update_local_potential();
+            charge_layout_full.recompute_system_energy();
+            charge_layout_full.validity_check();
+
+            for (uint64_t i = 0u; i < charge_layout_full.num_cells(); ++i)
+            {
+                CHECK_THAT(*charge_layout_incremental.get_local_potential_by_index(i) -
+                               *charge_layout_full.get_local_potential_by_index(i),
+                           Catch::Matchers::WithinAbs(0.0, 0.000001));
+            }
+
+            CHECK_THAT(charge_layout_incremental.get_system_energy() - charge_layout_full.get_system_energy(),
+                       Catch::Matchers::WithinAbs(0.0, 0.000001));
+            CHECK(charge_layout_incremental.is_physically_valid() == charge_layout_full.is_physically_valid());
+        };
+
+        // single charge changes
+        charge_layout_incremental.assign_charge_state_by_cell_index(1, sidb_charge_state::NEUTRAL);
+        charge_layout_full.assign_charge_state_by_cell_index(1, sidb_charge_state::NEUTRAL);
+        charge_layout_incremental.update_after_charge_change();
+        check_equivalence();
+
+        charge_layout_incremental.assign_charge_state_by_cell_index(3, sidb_charge_state::POSITIVE);
+        charge_layout_full.assign_charge_state_by_cell_index(3, sidb_charge_state::POSITIVE);
+        charge_layout_incremental.update_after_charge_change();
+        check_equivalence();
+
+        // batched charge changes
+        charge_layout_incremental.assign_charge_state({0, 0, 1}, sidb_charge_state::POSITIVE);
+        charge_layout_incremental.assign_charge_state({10, 5, 1}, sidb_charge_state::NEUTRAL);
+        charge_layout_full.assign_charge_state({0, 0, 1}, sidb_charge_state::POSITIVE);
+        charge_layout_full.assign_charge_state({10, 5, 1}, sidb_charge_state::NEUTRAL);
+        charge_layout_incremental.update_after_charge_change();
+        check_equivalence();
+
+        // an SiDB that is changed twice such that its charge change is reverted before the update
+        charge_layout_incremental.assign_charge_state_by_cell_index(2, sidb_charge_state::NEUTRAL);
+        charge_layout_incremental.assign_charge_state_by_cell_index(2, sidb_charge_state::NEGATIVE);
+        charge_layout_incremental.update_after_charge_change();
+        check_equivalence();
+
+        // changing all charge states at once falls back to a full update
+        charge_layout_incremental.set_all_charge_states(sidb_charge_state::NEGATIVE);
+        charge_layout_full.set_all_charge_states(sidb_charge_state::NEGATIVE);
+        charge_layout_incremental.update_after_charge_change();
+        check_equivalence();
+
+        // copies continue to be updated incrementally
+        auto charge_layout_copy = charge_distribution_surface{charge_layout_incremental};
+        charge_layout_copy.assign_charge_state_by_cell_index(4, sidb_charge_state::NEUTRAL);
+        charge_layout_full.assign_charge_state_by_cell_index(4, sidb_charge_state::NEUTRAL);
+        charge_layout_copy.update_after_charge_change();
+        charge_layout_incremental = charge_layout_copy;
+        check_equivalence();
+    }
+
+    SECTION("copies share the charge-independent model until the physical parameters change")
+    {
+        lyt.assign_cell_type({0, 0, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({4, 3, 1}, TestType::cell_type::NORMAL);
+        lyt.assign_cell_type({10, 5, 1}, TestType::cell_type::NORMAL);
+
+        charge_distribution_surface charge_layout{lyt, sidb_simulation_parameters{}};
+        charge_distribution_surface charge_layout_copy{charge_layout};
+
+        // charge changes of the copy do not affect the original
+        charge_layout_copy.assign_charge_state_by_cell_index(1, sidb_charge_state::NEUTRAL);
+        charge_layout_copy.update_after_charge_change();
+
+        CHECK(charge_layout.get_charge_state_by_index(1) == sidb_charge_state::NEGATIVE);
+        CHECK(charge_layout_copy.get_charge_state_by_index(1) == sidb_charge_state::NEUTRAL);
+        CHECK(charge_layout.get_system_energy() > charge_layout_copy.get_system_energy());
+
+        const auto potential_before = charge_layout.get_electrostatic_potential_by_indices(0, 1);
+
+        CHECK(charge_layout_copy.get_electrostatic_potential_by_indices(0, 1) == potential_before);
+
+        // a different relative permittivity with the same lattice changes the potentials of the copy only
+        charge_layout_copy.set_physical_parameters(sidb_simulation_parameters{3, -0.32, 2.8});
+
+        CHECK_THAT(charge_layout_copy.get_electrostatic_potential_by_indices(0, 1) - 2 * potential_before,
+                   Catch::Matchers::WithinAbs(0.0, 0.000001));
+        CHECK(charge_layout.get_electrostatic_potential_by_indices(0, 1) == potential_before);
+        CHECK(charge_layout.get_phys_params().epsilon_r == 5.6);
+        CHECK(charge_layout_copy.get_phys_params().epsilon_r == 2.8);
+
+        // a different lattice changes the distances of the copy only
+        const auto distance_before = charge_layout.get_distance_by_indices(0, 1);
+
+        charge_layout_copy.set_physical_parameters(sidb_simulation_parameters{3, -0.32, 5.6, 5.0 * 1E-9, 7.68 * 1E-10});
+
+        CHECK(charge_layout_copy.get_distance_by_indices(0, 1) > distance_before);
+        CHECK(charge_layout.get_distance_by_indices(0, 1) == distance_before);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "charge distribution surface of a subset", "[charge-distribution-surface]",
+    (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<siqad::coord_t, odd_row_hex>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({9, 1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    const charge_distribution_surface superset{lyt, sidb_simulation_parameters{3, -0.25}};
+
+    SECTION("identical SiDBs")
+    {
+        const charge_distribution_surface charge_layout{lyt, superset};
+
+        CHECK(charge_layout.get_phys_params().mu == -0.25);
+        CHECK(charge_layout.get_system_energy() == superset.get_system_energy());
+        CHECK(charge_layout.get_electrostatic_potential_by_indices(0, 3) ==
+              superset.get_electrostatic_potential_by_indices(0, 3));
+    }
+    SECTION("subset of SiDBs")
+    {
+        TestType subset_lyt{{20, 10}};
+
+        subset_lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+        subset_lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        subset_lyt.assign_cell_type({9, 1, 1}, TestType::cell_type::NORMAL);
+
+        charge_distribution_surface       charge_layout{subset_lyt, superset};
+        const charge_distribution_surface reference{subset_lyt, sidb_simulation_parameters{3, -0.25}};
+
+        REQUIRE(charge_layout.num_cells() == 3);
+
+        charge_layout.foreach_cell(
+            [&charge_layout, &reference](const auto& c1)
+            {
+                charge_layout.foreach_cell(
+                    [&charge_layout, &reference, &c1](const auto& c2)
+                    {
+                        CHECK_THAT(charge_layout.get_chargeless_potential_between_sidbs(c1, c2),
+                                   Catch::Matchers::WithinAbs(reference.get_chargeless_potential_between_sidbs(c1, c2),
+                                                              1E-12));
+                        CHECK_THAT(charge_layout.get_distance_between_cells(c1, c2),
+                                   Catch::Matchers::WithinAbs(reference.get_distance_between_cells(c1, c2), 1E-12));
+                    });
+            });
+
+        CHECK_THAT(charge_layout.get_system_energy(),
+                   Catch::Matchers::WithinAbs(reference.get_system_energy(), 1E-12));
+
+        charge_layout.assign_charge_state({0, 0, 0}, sidb_charge_state::NEUTRAL);
+        charge_layout.update_after_charge_change();
+
+        CHECK(charge_layout.get_charge_state({0, 0, 0}) == sidb_charge_state::NEUTRAL);
+        CHECK(superset.get_charge_state({0, 0, 0}) == sidb_charge_state::NEGATIVE);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "charge distribution surface in single precision", "[charge-distribution-surface]",
+    (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<siqad::coord_t, odd_row_hex>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({9, 1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({12, 3, 0}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters params{3, -0.25};
+
+    // single precision is accurate to about 7 significant digits of the potentials (unit: V)
+    const auto check_equivalence = [](const auto& single, const auto& reference)
+    {
+        REQUIRE(single.num_cells() == reference.num_cells());
+
+        for (uint64_t i = 0; i < reference.num_cells(); ++i)
+        {
+            CHECK(single.get_charge_state_by_index(i) == reference.get_charge_state_by_index(i));
+            CHECK_THAT(*single.get_local_potential_by_index(i),
+                       Catch::Matchers::WithinAbs(*reference.get_local_potential_by_index(i), 1E-6));
+
+            for (uint64_t j = 0; j < reference.num_cells(); ++j)
+            {
+                CHECK(single.get_distance_by_indices(i, j) == reference.get_distance_by_indices(i, j));
+                CHECK_THAT(single.get_electrostatic_potential_by_indices(i, j),
+                           Catch::Matchers::WithinAbs(reference.get_electrostatic_potential_by_indices(i, j), 1E-6));
+            }
+        }
+
+        CHECK_THAT(single.get_system_energy(), Catch::Matchers::WithinAbs(reference.get_system_energy(), 1E-6));
+        CHECK(single.is_physically_valid() == reference.is_physically_valid());
+    };
+
+    SECTION("construction from a layout")
+    {
+        charge_distribution_surface<TestType, false, float> single{lyt, params};
+        charge_distribution_surface<TestType>        reference{lyt, params};
+
+        check_equivalence(single, reference);
+
+        // incremental updates of the local potentials
+        single.assign_charge_state({5, 0, 0}, sidb_charge_state::NEUTRAL);
+        single.assign_charge_state({9, 1, 1}, sidb_charge_state::POSITIVE);
+        single.update_after_charge_change();
+
+        reference.assign_charge_state({5, 0, 0}, sidb_charge_state::NEUTRAL);
+        reference.assign_charge_state({9, 1, 1}, sidb_charge_state::POSITIVE);
+        reference.update_after_charge_change();
+
+        check_equivalence(single, reference);
+    }
+    SECTION("conversion between precisions")
+    {
+        charge_distribution_surface reference{lyt, params};
+
+        reference.assign_charge_state({0, 0, 0}, sidb_charge_state::NEUTRAL);
+        reference.update_after_charge_change();
+
+        const charge_distribution_surface<TestType, false, float> single{reference};
+
+        check_equivalence(single, reference);
+
+        const charge_distribution_surface<TestType> converted_back{single};
+
+        CHECK(converted_back.get_all_sidb_charges() == reference.get_all_sidb_charges());
+        CHECK(converted_back.get_charge_index() == reference.get_charge_index());
+    }
+    SECTION("cutoff radius")
+    {
+        auto sparse_params          = params;
+        sparse_params.cutoff_radius = 2 * 1E-9;
+
+        const charge_distribution_surface reference{lyt, sparse_params};
+
+        const charge_distribution_surface<TestType, false, float> single{reference};
+
+        CHECK(single.has_sparse_potentials());
+        CHECK(single.num_interactions() == reference.num_interactions());
+        check_equivalence(single, reference);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "charge distribution surface with a cutoff radius", "[charge-distribution-surface]",
+    (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<siqad::coord_t, odd_row_hex>>>))
+{
+    TestType lyt{{60, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({2, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 1, 1}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({20, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({23, 2, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({55, 0, 1}, TestType::cell_type::NORMAL);
+
+    sidb_simulation_parameters params{3, -0.25};
+
+    const charge_distribution_surface dense{lyt, params};
+
+    const auto num_sidbs = dense.num_cells();
+
+    // reference validity check that explicitly evaluates all hops between SiDBs based on the stored potentials
+    const auto is_valid = [num_sidbs](const auto& charge_layout)
+    {
+        const auto phys_params = charge_layout.get_phys_params();
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            const auto v_i  = *charge_layout.get_local_potential_by_index(i);
+            const auto cs_i = charge_layout.get_charge_state_by_index(i);
+
+            const auto err = physical_constants::POP_STABILITY_ERR;
+
+            if ((cs_i == sidb_charge_state::NEGATIVE && -v_i + phys_params.mu >= err) ||
+                (cs_i == sidb_charge_state::POSITIVE && -v_i + phys_params.mu_p <= -err) ||
+                (cs_i == sidb_charge_state::NEUTRAL &&
+                 (-v_i + phys_params.mu <= -err || -v_i + phys_params.mu_p >= err)))
+            {
+                return false;
+            }
+        }
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            const auto cs_i = charge_layout.get_charge_state_by_index(i);
+
+            if (cs_i == sidb_charge_state::POSITIVE)
+            {
+                continue;
+            }
+
+            const auto dn_i = cs_i == sidb_charge_state::NEGATIVE ? 1.0 : -1.0;
+
+            for (uint64_t j = 0; j < num_sidbs; ++j)
+            {
+                if (charge_state_to_sign(charge_layout.get_charge_state_by_index(j)) > charge_state_to_sign(cs_i) &&
+                    dn_i * (*charge_layout.get_local_potential_by_index(i) -
+                            *charge_layout.get_local_potential_by_index(j)) -
+                            charge_layout.get_electrostatic_potential_by_indices(i, j) <
+                        -physical_constants::POP_STABILITY_ERR)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    };
+
+    SECTION("a cutoff radius that exceeds the layout yields the dense potentials")
+    {
+        params.cutoff_radius = 100 * 1E-9;
+
+        charge_distribution_surface charge_layout{lyt, params};
+        auto                        reference = charge_distribution_surface{dense};
+
+        CHECK(charge_layout.has_sparse_potentials());
+        CHECK(!reference.has_sparse_potentials());
+        CHECK(charge_layout.num_interactions() == num_sidbs * (num_sidbs - 1));
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            for (uint64_t j = 0; j < num_sidbs; ++j)
+            {
+                CHECK(charge_layout.get_electrostatic_potential_by_indices(i, j) ==
+                      reference.get_electrostatic_potential_by_indices(i, j));
+                CHECK(charge_layout.get_distance_by_indices(i, j) == reference.get_distance_by_indices(i, j));
+            }
+        }
+
+        // all charge distributions are compared
+        charge_layout.assign_charge_index(0);
+        charge_layout.update_after_charge_change();
+        reference.assign_charge_index(0);
+        reference.update_after_charge_change();
+
+        while (true)
+        {
+            CHECK_THAT(charge_layout.get_system_energy(),
+                       Catch::Matchers::WithinAbs(reference.get_system_energy(), 1E-12));
+            CHECK(charge_layout.is_physically_valid() == reference.is_physically_valid());
+
+            if (charge_layout.get_charge_index().first == charge_layout.get_max_charge_index())
+            {
+                break;
+            }
+
+            charge_layout.increase_charge_index_by_one();
+            reference.increase_charge_index_by_one();
+        }
+    }
+    SECTION("only SiDBs within the cutoff radius interact")
+    {
+        params.cutoff_radius = 2 * 1E-9;
+
+        charge_distribution_surface charge_layout{lyt, params};
+
+        uint64_t num_pairs_within_cutoff = 0;
+
+        for (uint64_t i = 0; i < num_sidbs; ++i)
+        {
+            for (uint64_t j = 0; j < num_sidbs; ++j)
+            {
+                CHECK(charge_layout.get_distance_by_indices(i, j) == dense.get_distance_by_indices(i, j));
+
+                if (i != j && dense.get_distance_by_indices(i, j) <= params.cutoff_radius)
+                {
+                    ++num_pairs_within_cutoff;
+
+                    CHECK(charge_layout.get_electrostatic_potential_by_indices(i, j) ==
+                          dense.get_electrostatic_potential_by_indices(i, j));
+                }
+                else
+                {
+                    CHECK(charge_layout.get_electrostatic_potential_by_indices(i, j) == 0.0);
+                }
+            }
+        }
+
+        REQUIRE(num_pairs_within_cutoff > 0);
+        CHECK(charge_layout.num_interactions() == num_pairs_within_cutoff);
+        CHECK(charge_layout.num_interactions() < num_sidbs * (num_sidbs - 1));
+
+        // the validity of all charge distributions is compared with the explicit evaluation of all hops
+        charge_layout.assign_charge_index(0);
+        charge_layout.update_after_charge_change();
+
+        uint64_t num_valid = 0;
+
+        while (true)
+        {
+            CHECK(charge_layout.is_physically_valid() == is_valid(charge_layout));
+
+            num_valid += charge_layout.is_physically_valid() ? 1 : 0;
+
+            if (charge_layout.get_charge_index().first == charge_layout.get_max_charge_index())
+            {
+                break;
+            }
+
+            charge_layout.increase_charge_index_by_one();
+        }
+
+        CHECK(num_valid > 0);
+    }
+    SECTION("changing the cutoff radius")
+    {
+        auto charge_layout = charge_distribution_surface{dense};
+
+        params.cutoff_radius = 2 * 1E-9;
+        charge_layout.set_physical_parameters(params);
+
+        CHECK(charge_layout.has_sparse_potentials());
+        CHECK(charge_layout.get_electrostatic_potential_by_indices(0, 5) == 0.0);
+        CHECK(dense.get_electrostatic_potential_by_indices(0, 5) > 0.0);
+
+        params.cutoff_radius = 0.0;
+        charge_layout.set_physical_parameters(params);
+
+        CHECK(!charge_layout.has_sparse_potentials());
+        CHECK(charge_layout.get_electrostatic_potential_by_indices(0, 5) ==
+              dense.get_electrostatic_potential_by_indices(0, 5));
+        CHECK(charge_layout.get_system_energy() == dense.get_system_energy());
+    }
+    SECTION("subset of a charge distribution surface with a cutoff radius")
+    {
+        params.cutoff_radius = 2 * 1E-9;
+
+        const charge_distribution_surface superset{lyt, params};
+
+        TestType subset_lyt{{60, 10}};
+
+        subset_lyt.assign_cell_type({2, 0, 0}, TestType::cell_type::NORMAL);
+        subset_lyt.assign_cell_type({5, 1, 1}, TestType::cell_type::NORMAL);
+        subset_lyt.assign_cell_type({23, 2, 0}, TestType::cell_type::NORMAL);
+
+        const charge_distribution_surface charge_layout{subset_lyt, superset};
+        const charge_distribution_surface reference{subset_lyt, params};
+
+        REQUIRE(charge_layout.has_sparse_potentials());
+        CHECK(charge_layout.num_interactions() == reference.num_interactions());
+
+        for (uint64_t i = 0; i < 3; ++i)
+        {
+            for (uint64_t j = 0; j < 3; ++j)
+            {
+                CHECK(charge_layout.get_electrostatic_potential_by_indices(i, j) ==
+                      reference.get_electrostatic_potential_by_indices(i, j));
+            }
+        }
+
+        CHECK(charge_layout.get_system_energy() == reference.get_system_energy());
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "charge distribution surface with external charges", "[charge-distribution-surface]",
+    (sidb_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>>),
+    (sidb_surface<cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<siqad::coord_t, odd_row_hex>>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+
+    // the same layout with a third SiDB at the position of the external charge
+    TestType reference_lyt{{20, 10}};
+    reference_lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    reference_lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+    reference_lyt.assign_cell_type({8, 1, 1}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters params{3, -0.32};
+
+    const charge_distribution_surface reference{reference_lyt, params, sidb_charge_state::NEGATIVE};
+
+    SECTION("no external charges")
+    {
+        const charge_distribution_surface charge_layout{lyt, params};
+
+        CHECK(charge_layout.get_external_charges().empty());
+        CHECK(charge_layout.get_external_potential_by_index(0) == 0.0);
+    }
+    SECTION("explicitly assigned external charge")
+    {
+        charge_distribution_surface charge_layout{lyt, params};
+
+        charge_layout.assign_external_charges({{{8, 1, 1}, sidb_defect{sidb_defect_type::UNKNOWN, -1.0}}});
+
+        REQUIRE(charge_layout.get_external_charges().size() == 1);
+
+        // a negative external charge acts like a negative SiDB that uses the same physical parameters
+        for (uint64_t i = 0; i < 2; ++i)
+        {
+            CHECK_THAT(charge_layout.get_external_potential_by_index(i),
+                       Catch::Matchers::WithinAbs(-reference.get_electrostatic_potential_by_indices(i, 2), 1E-12));
+            CHECK_THAT(*charge_layout.get_local_potential_by_index(i),
+                       Catch::Matchers::WithinAbs(*reference.get_local_potential_by_index(i), 1E-12));
+        }
+
+        CHECK_THAT(charge_layout.get_system_energy(), Catch::Matchers::WithinAbs(reference.get_system_energy(), 1E-12));
+        CHECK(charge_layout.is_physically_valid() == reference.is_physically_valid());
+
+        // incremental updates retain the external potential
+        charge_layout.assign_charge_state({3, 0, 0}, sidb_charge_state::NEUTRAL);
+        charge_layout.update_after_charge_change();
+
+        auto reference_copy = charge_distribution_surface{reference};
+        reference_copy.assign_charge_state({3, 0, 0}, sidb_charge_state::NEUTRAL);
+        reference_copy.update_after_charge_change();
+
+        CHECK_THAT(*charge_layout.get_local_potential_by_index(0),
+                   Catch::Matchers::WithinAbs(*reference_copy.get_local_potential_by_index(0), 1E-12));
+        CHECK_THAT(charge_layout.get_system_energy(),
+                   Catch::Matchers::WithinAbs(reference_copy.get_system_energy(), 1E-12));
+
+        // copies share the external charges and removing them does not affect the copies
+        const auto copy = charge_distribution_surface{charge_layout};
+
+        charge_layout.assign_external_charges({});
+
+        CHECK(charge_layout.get_external_charges().empty());
+        CHECK(charge_layout.get_external_potential_by_index(0) == 0.0);
+        CHECK(copy.get_external_charges().size() == 1);
+    }
+    SECTION("charged defects of the SiDB surface")
+    {
+        lyt.assign_sidb_defect({8, 1, 1}, sidb_defect{sidb_defect_type::DB, -1.0});
+        lyt.assign_sidb_defect({15, 5, 0}, sidb_defect{sidb_defect_type::SILOXANE});
+
+        const charge_distribution_surface charge_layout{lyt, params};
+
+        // neutral defects are not considered
+        REQUIRE(charge_layout.get_external_charges().size() == 1);
+        CHECK(charge_layout.get_external_charges().front().first == typename TestType::cell{8, 1, 1});
+
+        CHECK_THAT(charge_layout.get_system_energy(), Catch::Matchers::WithinAbs(reference.get_system_energy(), 1E-12));
+
+        // the defect's own screening parameters are used if they are specified
+        TestType screened_lyt{{20, 10}};
+        screened_lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+        screened_lyt.assign_cell_type({3, 0, 0}, TestType::cell_type::NORMAL);
+        screened_lyt.assign_sidb_defect({8, 1, 1}, sidb_defect{sidb_defect_type::DB, -1.0, 5.6, 2.0});
+
+        const charge_distribution_surface screened_layout{screened_lyt, params};
+
+        CHECK(screened_layout.get_external_potential_by_index(1) < 0.0);
+        CHECK(screened_layout.get_external_potential_by_index(1) > charge_layout.get_external_potential_by_index(1));
+
+        // the external potential is recomputed if the physical parameters change
+        auto changed_layout = charge_distribution_surface{charge_layout};
+        changed_layout.set_physical_parameters(sidb_simulation_parameters{3, -0.32, 2.8});
+
+        CHECK_THAT(changed_layout.get_external_potential_by_index(1),
+                   Catch::Matchers::WithinRel(2 * charge_layout.get_external_potential_by_index(1), 1E-12));
+    }
 }
@@ -0,0 +1,127 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/algorithms/simulation/sidb/exhaustive_ground_state_simulation.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/charge_distribution_surface.hpp>
+#include <fiction/technology/compact_charge_distribution.hpp>
+#include <fiction/technology/physical_constants.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Packed charge distribution", "[compact-charge-distribution]")
+{
+    SECTION("empty")
+    {
+        const packed_charge_distribution packed{};
+
+        CHECK(packed.size() == 0);
+        CHECK(packed.get_all_charge_states().empty());
+    }
+    SECTION("more SiDBs than fit into a single word")
+    {
+        std::vector<sidb_charge_state> charge_states{};
+
+        for (auto i = 0u; i < 75; ++i)
+        {
+            charge_states.push_back(i % 3 == 0 ? sidb_charge_state::NEGATIVE :
+                                    i % 3 == 1 ? sidb_charge_state::NEUTRAL :
+                                                 sidb_charge_state::POSITIVE);
+        }
+
+        packed_charge_distribution packed{charge_states};
+
+        CHECK(packed.size() == 75);
+        CHECK(packed.get_all_charge_states() == charge_states);
+
+        packed.assign_charge_state(31, sidb_charge_state::NONE);
+        packed.assign_charge_state(32, sidb_charge_state::NEGATIVE);
+        charge_states[31] = sidb_charge_state::NONE;
+        charge_states[32] = sidb_charge_state::NEGATIVE;
+
+        CHECK(packed.get_charge_state(30) == sidb_charge_state::NEGATIVE);
+        CHECK(packed.get_charge_state(31) == sidb_charge_state::NONE);
+        CHECK(packed.get_charge_state(32) == sidb_charge_state::NEGATIVE);
+        CHECK(packed.get_charge_state(33) == sidb_charge_state::NEGATIVE);
+        CHECK(packed.get_all_charge_states() == charge_states);
+
+        CHECK(packed == packed_charge_distribution{charge_states});
+        CHECK(packed != packed_charge_distribution{});
+    }
+}
+
+TEMPLATE_TEST_CASE("Compact charge distributions", "[compact-charge-distribution]",
+                   (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<siqad::coord_t>>>))
+{
+    TestType lyt{{20, 10}};
+
+    lyt.assign_cell_type({0, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({5, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({7, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({11, 0, 0}, TestType::cell_type::NORMAL);
+    lyt.assign_cell_type({13, 0, 0}, TestType::cell_type::NORMAL);
+
+    const sidb_simulation_parameters params{3, -0.25};
+
+    SECTION("storing and materializing")
+    {
+        charge_distribution_surface charge_lyt{lyt, params, sidb_charge_state::NEUTRAL};
+        charge_lyt.assign_charge_state_by_cell_index(0, sidb_charge_state::NEGATIVE);
+        charge_lyt.assign_charge_state_by_cell_index(2, sidb_charge_state::POSITIVE);
+        charge_lyt.update_after_charge_change();
+        charge_lyt.charge_distribution_to_index();
+
+        compact_charge_distributions<TestType> compact_lyts{};
+        CHECK(compact_lyts.empty());
+        CHECK(compact_lyts.get_model() == nullptr);
+
+        compact_lyts.add(charge_lyt);
+
+        REQUIRE(compact_lyts.size() == 1);
+        REQUIRE(compact_lyts.get_model() != nullptr);
+        CHECK(compact_lyts[0].charges.get_all_charge_states() == charge_lyt.get_all_sidb_charges());
+        CHECK(compact_lyts[0].system_energy == charge_lyt.get_system_energy());
+        CHECK(compact_lyts[0].validity == charge_lyt.is_physically_valid());
+        CHECK(compact_lyts[0].charge_index == charge_lyt.get_charge_index().first);
+
+        const auto materialized_lyt = compact_lyts.materialize(0);
+
+        CHECK(materialized_lyt.get_all_sidb_charges() == charge_lyt.get_all_sidb_charges());
+        CHECK(materialized_lyt.get_charge_index() == charge_lyt.get_charge_index());
+        CHECK(materialized_lyt.is_physically_valid() == charge_lyt.is_physically_valid());
+        CHECK_THAT(materialized_lyt.get_system_energy() - charge_lyt.get_system_energy(),
+                   Catch::Matchers::WithinAbs(0.0, fiction::physical_constants::POP_STABILITY_ERR));
+    }
+    SECTION("exhaustive ground state simulation")
+    {
+        exgs_stats<TestType> stats{};
+        exgs_stats<TestType> compact_stats{};
+
+        exhaustive_ground_state_simulation<TestType>(lyt, exgs_params{params}, &stats);
+        exhaustive_ground_state_simulation<TestType>(
+            lyt, exgs_params{params, exgs_enumeration::GRAY_CODE, 2, true}, &compact_stats);
+
+        CHECK(compact_stats.valid_lyts.empty());
+        REQUIRE(!stats.valid_lyts.empty());
+        REQUIRE(compact_stats.compact_valid_lyts.size() == stats.valid_lyts.size());
+
+        CHECK_THAT(minimum_energy(compact_stats.compact_valid_lyts) - minimum_energy(stats.valid_lyts),
+                   Catch::Matchers::WithinAbs(0.0, fiction::physical_constants::POP_STABILITY_ERR));
+        CHECK(energy_distribution(compact_stats.compact_valid_lyts) == energy_distribution(stats.valid_lyts));
+
+        for (auto i = 0u; i < stats.valid_lyts.size(); ++i)
+        {
+            const auto materialized_lyt = compact_stats.compact_valid_lyts.materialize(i);
+
+            CHECK(compact_stats.compact_valid_lyts[i].validity);
+            CHECK(materialized_lyt.is_physically_valid());
+            CHECK(materialized_lyt.get_charge_index() == stats.valid_lyts[i].get_charge_index());
+            CHECK(materialized_lyt.get_all_sidb_charges() == stats.valid_lyts[i].get_all_sidb_charges());
+        }
+    }
+}
@@ -351,6 +351,8 @@ TEMPLATE_TEST_CASE(
         const sidb_surface_params params{std::unordered_set<sidb_defect_type>{sidb_defect_type::DB}};
         sidb_surface<TestType>    defect_layout{lyt, params};
 
+        CHECK(defect_layout.get_sidb_surface_parameters().ignore == params.ignore);
+
         defect_layout.assign_sidb_defect({2, 2}, sidb_defect{sidb_defect_type::DB});
 
         // number of defects should not count the ignored defect
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/aligned_matrix.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+using namespace fiction;
+
+TEST_CASE("Aligned vector", "[aligned-matrix]")
+{
+    for (std::size_t n = 1; n < 20; ++n)
+    {
+        const aligned_vector<double> v(n, 1.0);
+
+        CHECK(reinterpret_cast<std::uintptr_t>(v.data()) % CACHE_LINE_ALIGNMENT == 0);
+    }
+}
+
+TEST_CASE("Aligned matrix", "[aligned-matrix]")
+{
+    SECTION("empty matrix")
+    {
+        const aligned_matrix<double> m{};
+
+        CHECK(m.size() == 0);
+        CHECK(m.columns() == 0);
+    }
+    SECTION("rows are padded and aligned")
+    {
+        aligned_matrix<double> m{5, 3, 0.5};
+
+        CHECK(m.size() == 5);
+        CHECK(m.columns() == 3);
+        CHECK(m.stride() == 8);
+
+        for (std::size_t i = 0; i < m.size(); ++i)
+        {
+            CHECK(reinterpret_cast<std::uintptr_t>(m[i]) % CACHE_LINE_ALIGNMENT == 0);
+
+            for (std::size_t j = 0; j < m.columns(); ++j)
+            {
+                CHECK(m(i, j) == 0.5);
+            }
+        }
+    }
+    SECTION("element access")
+    {
+        aligned_matrix<double> m{9, 9};
+
+        CHECK(m.stride() == 16);
+
+        for (std::size_t i = 0; i < m.size(); ++i)
+        {
+            for (std::size_t j = 0; j < m.columns(); ++j)
+            {
+                m[i][j] = static_cast<double>(i * 10 + j);
+            }
+        }
+
+        const auto& cm = m;
+
+        for (std::size_t i = 0; i < cm.size(); ++i)
+        {
+            for (std::size_t j = 0; j < cm.columns(); ++j)
+            {
+                CHECK(cm(i, j) == static_cast<double>(i * 10 + j));
+                CHECK(cm[i][j] == cm(i, j));
+            }
+        }
+    }
+}
+
+TEST_CASE("Packed symmetric matrix", "[aligned-matrix]")
+{
+    SECTION("empty matrix")
+    {
+        const packed_symmetric_matrix<double> m{};
+
+        CHECK(m.size() == 0);
+    }
+    SECTION("symmetric element access")
+    {
+        packed_symmetric_matrix<double> m{6, 1.0};
+
+        CHECK(m.size() == 6);
+
+        for (std::size_t i = 0; i < m.size(); ++i)
+        {
+            for (std::size_t j = i; j < m.size(); ++j)
+            {
+                CHECK(m(i, j) == 1.0);
+
+                m(i, j) = static_cast<double>(i * 10 + j);
+            }
+        }
+
+        for (std::size_t i = 0; i < m.size(); ++i)
+        {
+            for (std::size_t j = 0; j < m.size(); ++j)
+            {
+                CHECK(m(i, j) == m(j, i));
+                CHECK(m(i, j) == static_cast<double>(std::min(i, j) * 10 + std::max(i, j)));
+            }
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <fiction/utils/aligned_matrix.hpp>
+#include <fiction/utils/simd_utils.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using namespace fiction;
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+
+aligned_vector<double> generate_values(const std::size_t n, const double offset)
+{
+    aligned_vector<double> values(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        values[i] = offset + static_cast<double>((i * 7) % 11) * 0.25 - 1.0;
+    }
+
+    return values;
+}
+
+aligned_vector<double> generate_signs(const std::size_t n)
+{
+    aligned_vector<double> signs(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        signs[i] = static_cast<double>(static_cast<int>(i % 3) - 1);
+    }
+
+    return signs;
+}
+
+aligned_vector<float> to_float(const aligned_vector<double>& values)
+{
+    return aligned_vector<float>(values.cbegin(), values.cend());
+}
+
+}  // namespace
+
+TEST_CASE("Dot product", "[simd-utils]")
+{
+    // all lengths up to several register widths to cover the vectorized loops as well as their remainders
+    for (std::size_t n = 0; n < 40; ++n)
+    {
+        const auto a = generate_values(n, 0.5);
+        const auto b = generate_signs(n);
+
+        double expected = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            expected += a[i] * b[i];
+        }
+
+        CHECK_THAT(dot_product(a.data(), b.data(), n), WithinAbs(expected, 1E-12));
+    }
+}
+
+TEST_CASE("Scaled add", "[simd-utils]")
+{
+    for (std::size_t n = 0; n < 40; ++n)
+    {
+        auto       y = generate_values(n, 0.0);
+        const auto x = generate_values(n, 2.0);
+
+        const auto y_before = y;
+
+        scaled_add(y.data(), x.data(), -1.5, n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK_THAT(y[i], WithinAbs(y_before[i] - 1.5 * x[i], 1E-12));
+        }
+    }
+}
+
+TEST_CASE("Hop below threshold", "[simd-utils]")
+{
+    for (std::size_t n = 1; n < 40; ++n)
+    {
+        const auto r     = generate_values(n, 1.0);
+        const auto x     = generate_values(n, -0.5);
+        const auto signs = generate_signs(n);
+
+        for (const auto sign : std::vector<double>{-1.0, 0.0, 1.0})
+        {
+            for (const auto threshold : std::vector<double>{-10.0, -1.0, 0.0, 1.0})
+            {
+                bool expected = false;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    expected = expected || (signs[i] > sign && 1.0 * (0.25 - x[i]) - r[i] < threshold);
+                }
+
+                CHECK(any_hop_below_threshold(r.data(), x.data(), signs.data(), n, sign, 0.25, 1.0, threshold) ==
+                      expected);
+            }
+        }
+    }
+
+    SECTION("only the last element qualifies")
+    {
+        for (std::size_t n = 1; n < 20; ++n)
+        {
+            const aligned_vector<double> r(n, 0.0);
+            const aligned_vector<double> x(n, 0.0);
+            aligned_vector<double>       signs(n, -1.0);
+            signs[n - 1] = 0.0;
+
+            CHECK(any_hop_below_threshold(r.data(), x.data(), signs.data(), n, -1.0, -1.0, 1.0, -0.5));
+            CHECK(!any_hop_below_threshold(r.data(), x.data(), signs.data(), n - 1, -1.0, -1.0, 1.0, -0.5));
+        }
+    }
+}
+
+TEST_CASE("Single-precision kernels", "[simd-utils]")
+{
+    // twice as many elements fit into a register; hence, longer arrays are needed to cover all loops
+    for (std::size_t n = 1; n < 80; ++n)
+    {
+        const auto r     = to_float(generate_values(n, 1.0));
+        const auto x     = to_float(generate_values(n, -0.5));
+        const auto signs = to_float(generate_signs(n));
+
+        double expected_dot = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            expected_dot += static_cast<double>(r[i]) * static_cast<double>(signs[i]);
+        }
+
+        CHECK_THAT(dot_product(r.data(), signs.data(), n), WithinAbs(expected_dot, 1E-4));
+
+        auto y = x;
+        scaled_add(y.data(), r.data(), -1.5f, n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK_THAT(y[i], WithinAbs(x[i] - 1.5 * r[i], 1E-5));
+        }
+
+        for (const auto sign : std::vector<float>{-1.0f, 0.0f, 1.0f})
+        {
+            for (const auto threshold : std::vector<float>{-10.0f, -1.0f, 0.0f, 1.0f})
+            {
+                bool expected = false;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    expected = expected || (signs[i] > sign && 1.0f * (0.25f - x[i]) - r[i] < threshold);
+                }
+
+                CHECK(any_hop_below_threshold(r.data(), x.data(), signs.data(), n, sign, 0.25f, 1.0f, threshold) ==
+                      expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/sparse_matrix.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("CSR matrix", "[sparse-matrix]")
+{
+    SECTION("empty matrix")
+    {
+        const csr_matrix<double> m{};
+
+        CHECK(m.size() == 0);
+        CHECK(m.num_non_zeros() == 0);
+    }
+    SECTION("construction and access")
+    {
+        // [[0, 1, 0], [2, 0, 3], [0, 0, 0]]
+        csr_matrix<double> m{};
+
+        m.push_back(1, 1.0);
+        m.end_row();
+        m.push_back(0, 2.0);
+        m.push_back(2, 3.0);
+        m.end_row();
+        m.end_row();
+
+        CHECK(m.size() == 3);
+        CHECK(m.num_non_zeros() == 3);
+        CHECK(m.row_size(0) == 1);
+        CHECK(m.row_size(1) == 2);
+        CHECK(m.row_size(2) == 0);
+
+        CHECK(m(0, 0) == 0.0);
+        CHECK(m(0, 1) == 1.0);
+        CHECK(m(1, 0) == 2.0);
+        CHECK(m(1, 1) == 0.0);
+        CHECK(m(1, 2) == 3.0);
+        CHECK(m(2, 2) == 0.0);
+
+        const std::vector<double> x{1.0, 2.0, 3.0};
+
+        CHECK(m.dot_row(0, x.data()) == 2.0);
+        CHECK(m.dot_row(1, x.data()) == 11.0);
+        CHECK(m.dot_row(2, x.data()) == 0.0);
+
+        std::vector<double> y{1.0, 1.0, 1.0};
+        m.scaled_add_row(1, -2.0, y.data());
+
+        CHECK(y == std::vector<double>{-3.0, 1.0, -5.0});
+    }
+}